@@ -10,6 +10,7 @@
 
 #include "vhosts/vhosts_controller.h"
 #include "internals/internals_controller.h"
+#include "metrics/metrics_controller.h"
 
 namespace api
 {
@@ -23,6 +24,7 @@ namespace api
 
 				CreateSubController<VHostsController>(R"(\/vhosts)");
 				CreateSubController<InternalsController>(R"(\/internals)");
+				CreateSubController<MetricsController>(R"(\/metrics)");
 			}
 
 			ApiResponse CurrentController::OnGetServerMetrics(const std::shared_ptr<http::svr::HttpExchange> &client)
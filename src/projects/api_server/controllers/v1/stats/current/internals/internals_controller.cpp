@@ -18,6 +18,8 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/sockets)", &InternalsController::OnGetSockets);
+				RegisterGet(R"(\/dataPool)", &InternalsController::OnGetDataPool);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +27,8 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/sockets");
+				response.append("/v1/stats/current/internals/dataPool");
 
 				return response;
 			}
@@ -47,6 +51,20 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetSockets(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response;
+
+				response["egress"] = serdes::JsonFromDatagramBatchStatistics(ov::DatagramSendBatch::GetStatistics());
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetDataPool(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				return serdes::JsonFromDataPoolStatistics(ov::DataPool::GetStatistics());
+			}
 		}  // namespace stats
 	}	   // namespace v1
 }  // namespace api
\ No newline at end of file
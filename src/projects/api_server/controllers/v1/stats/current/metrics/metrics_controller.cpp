@@ -0,0 +1,190 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "metrics_controller.h"
+
+namespace api
+{
+	namespace v1
+	{
+		namespace stats
+		{
+			struct MetricsTarget
+			{
+				std::shared_ptr<mon::CommonMetrics> metrics;
+				// Labels of the target (e.g. vhost="default",app="app")
+				ov::String labels;
+			};
+
+			static ov::String EscapeLabelValue(const ov::String &value)
+			{
+				ov::String escaped;
+
+				for (size_t index = 0; index < value.GetLength(); index++)
+				{
+					auto c = value[index];
+
+					switch (c)
+					{
+						case '\\':
+							escaped.Append("\\\\");
+							break;
+						case '"':
+							escaped.Append("\\\"");
+							break;
+						case '\n':
+							escaped.Append("\\n");
+							break;
+						default:
+							escaped.Append(c);
+							break;
+					}
+				}
+
+				return escaped;
+			}
+
+			static void AppendFamily(ov::String &output, const ov::String &name, const char *type, const char *help)
+			{
+				output.AppendFormat("# TYPE %s %s\n", name.CStr(), type);
+				output.AppendFormat("# HELP %s %s\n", name.CStr(), help);
+			}
+
+			static void AppendSample(ov::String &output, const ov::String &name, const ov::String &labels, uint64_t value)
+			{
+				if (labels.IsEmpty())
+				{
+					output.AppendFormat("%s %" PRIu64 "\n", name.CStr(), value);
+				}
+				else
+				{
+					output.AppendFormat("%s{%s} %" PRIu64 "\n", name.CStr(), labels.CStr(), value);
+				}
+			}
+
+			static ov::String AppendLabel(const ov::String &labels, const char *key, const ov::String &value)
+			{
+				return ov::String::FormatString("%s%s%s=\"%s\"", labels.CStr(), labels.IsEmpty() ? "" : ",", key, EscapeLabelValue(value).CStr());
+			}
+
+			// Each family must be written at once, so the families are written for all the targets of a scope one by one
+			static void AppendMetricsOfScope(ov::String &output, const char *scope, const std::vector<MetricsTarget> &targets)
+			{
+				auto prefix = ov::String::FormatString("ome_%s", scope);
+
+				auto name = prefix + "_bytes_in";
+				AppendFamily(output, name, "counter", "Bytes received from providers");
+				for (const auto &target : targets)
+				{
+					AppendSample(output, name + "_total", target.labels, target.metrics->GetTotalBytesIn());
+				}
+
+				name = prefix + "_bytes_out";
+				AppendFamily(output, name, "counter", "Bytes sent by publishers");
+				for (const auto &target : targets)
+				{
+					for (int i = static_cast<int>(PublisherType::Unknown) + 1; i < static_cast<int>(PublisherType::NumberOfPublishers); i++)
+					{
+						auto type = static_cast<PublisherType>(i);
+						auto labels = AppendLabel(target.labels, "publisher", ::StringFromPublisherType(type).LowerCaseString());
+
+						AppendSample(output, name + "_total", labels, target.metrics->GetBytesOut(type));
+					}
+				}
+
+				name = prefix + "_bitrate_in";
+				AppendFamily(output, name, "gauge", "Average bitrate (bps) received from providers in the last second");
+				for (const auto &target : targets)
+				{
+					AppendSample(output, name, target.labels, target.metrics->GetAvgThroughputIn());
+				}
+
+				name = prefix + "_bitrate_out";
+				AppendFamily(output, name, "gauge", "Average bitrate (bps) sent by publishers in the last second");
+				for (const auto &target : targets)
+				{
+					AppendSample(output, name, target.labels, target.metrics->GetAvgThroughputOut());
+				}
+
+				name = prefix + "_connections";
+				AppendFamily(output, name, "gauge", "Number of sessions currently connected");
+				for (const auto &target : targets)
+				{
+					for (int i = static_cast<int>(PublisherType::Unknown) + 1; i < static_cast<int>(PublisherType::NumberOfPublishers); i++)
+					{
+						auto type = static_cast<PublisherType>(i);
+						auto labels = AppendLabel(target.labels, "publisher", ::StringFromPublisherType(type).LowerCaseString());
+
+						AppendSample(output, name, labels, target.metrics->GetConnections(type));
+					}
+				}
+
+				name = prefix + "_max_connections";
+				AppendFamily(output, name, "gauge", "Maximum number of sessions connected at the same time");
+				for (const auto &target : targets)
+				{
+					AppendSample(output, name, target.labels, target.metrics->GetMaxTotalConnections());
+				}
+			}
+
+			void MetricsController::PrepareHandlers()
+			{
+				Register(http::Method::Get, R"()", &MetricsController::OnGetMetrics);
+			};
+
+			void MetricsController::OnGetMetrics(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				// The counters are read from the metrics without taking any lock of the media threads
+				// (the counters are summed from the shards here, see mon::ShardedCounters)
+				auto server_metrics = MonitorInstance->GetServerMetrics();
+
+				std::vector<MetricsTarget> vhost_targets;
+				std::vector<MetricsTarget> app_targets;
+				std::vector<MetricsTarget> stream_targets;
+
+				for (const auto &[vhost_id, vhost_metrics] : server_metrics->GetHostMetricsList())
+				{
+					auto vhost_labels = AppendLabel("", "vhost", vhost_metrics->GetName());
+					vhost_targets.push_back({vhost_metrics, vhost_labels});
+
+					for (const auto &[app_id, app_metrics] : vhost_metrics->GetApplicationMetricsList())
+					{
+						auto app_labels = AppendLabel(vhost_labels, "app", app_metrics->GetName().GetAppName());
+						app_targets.push_back({app_metrics, app_labels});
+
+						for (const auto &[stream_id, stream_metrics] : app_metrics->GetStreamMetricsMap())
+						{
+							// Output streams are counted in their input stream
+							if (stream_metrics->GetLinkedInputStream() != nullptr)
+							{
+								continue;
+							}
+
+							stream_targets.push_back({stream_metrics, AppendLabel(app_labels, "stream", stream_metrics->GetName())});
+						}
+					}
+				}
+
+				ov::String output;
+
+				AppendMetricsOfScope(output, "server", {{server_metrics, ""}});
+				AppendMetricsOfScope(output, "vhost", vhost_targets);
+				AppendMetricsOfScope(output, "app", app_targets);
+				AppendMetricsOfScope(output, "stream", stream_targets);
+
+				output.Append("# EOF\n");
+
+				auto response = client->GetResponse();
+
+				response->SetStatusCode(http::StatusCode::OK);
+				response->SetHeader("Content-Type", "application/openmetrics-text; version=1.0.0; charset=utf-8");
+				response->AppendString(output);
+			}
+		}  // namespace stats
+	}	   // namespace v1
+}  // namespace api
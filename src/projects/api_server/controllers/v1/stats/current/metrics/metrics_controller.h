@@ -0,0 +1,30 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../../../controller.h"
+
+namespace api
+{
+	namespace v1
+	{
+		namespace stats
+		{
+			// Exposes the metrics of server/vhosts/apps/streams in the OpenMetrics text format (for Prometheus)
+			class MetricsController : public Controller<MetricsController>
+			{
+			public:
+				void PrepareHandlers() override;
+
+			protected:
+				void OnGetMetrics(const std::shared_ptr<http::svr::HttpExchange> &client);
+			};
+		}  // namespace stats
+	}	   // namespace v1
+}  // namespace api
@@ -25,7 +25,16 @@ namespace api
 													   const std::shared_ptr<mon::StreamMetrics> &stream,
 													   const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
 			{
-				return ::serdes::JsonFromMetrics(stream);
+				auto value = ::serdes::JsonFromMetrics(stream);
+
+				// Only available when <Modules><LatencyTrace> is enabled
+				auto latency = ::serdes::JsonFromLatencyMetrics(stream);
+				if (latency.isNull() == false)
+				{
+					value["latency"] = latency;
+				}
+
+				return value;
 			}
 		}  // namespace stats
 	}	   // namespace v1
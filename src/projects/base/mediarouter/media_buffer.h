@@ -14,6 +14,7 @@
 #include <stdint.h>
 #include <map>
 
+#include "media_trace.h"
 #include "media_type.h"
 
 
@@ -229,6 +230,17 @@ public:
 		return &_frag_hdr;
 	}
 
+	// Only the sampled packets have a trace (see MediaRouteApplication)
+	const std::shared_ptr<MediaTrace> &GetTrace() const
+	{
+		return _trace;
+	}
+
+	void SetTrace(const std::shared_ptr<MediaTrace> &trace)
+	{
+		_trace = trace;
+	}
+
 	std::shared_ptr<MediaPacket> ClonePacket() const
 	{
 		auto packet = std::make_shared<MediaPacket>(
@@ -245,6 +257,11 @@ public:
 
 		packet->_frag_hdr = _frag_hdr;
 
+		if (_trace != nullptr)
+		{
+			packet->_trace = _trace->Clone();
+		}
+
 		return packet;
 	}
 
@@ -278,5 +295,7 @@ protected:
 	cmn::BitstreamFormat _bitstream_format = cmn::BitstreamFormat::Unknown;
 	cmn::PacketType _packet_type = cmn::PacketType::Unknown;
 	FragmentationHeader _frag_hdr;
+
+	std::shared_ptr<MediaTrace> _trace;
 };
 
@@ -0,0 +1,182 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+// The number of traces that can wait for the output of a component (decoder, filter, encoder).
+// If the output of a traced input is dropped, the trace is evicted by the newer ones.
+#define MEDIA_TRACE_MAP_MAX_SIZE 32
+// The difference allowed between the timestamps of the input and the output of a component (in microseconds)
+#define MEDIA_TRACE_PTS_TOLERANCE_US 1000
+
+// Timestamps of a sampled media packet at each point of the pipeline
+//
+//  Provider -> [RouterInbound] -> [InboundDelivered] -> Transcoder
+//     -> [Decoded] -> [Filtered] -> [Encoded] (not marked if the track is bypassed)
+//     -> [RouterOutbound] -> [OutboundDelivered] -> [PublisherDequeued] -> [Published]
+class MediaTrace
+{
+public:
+	enum class Point : uint8_t
+	{
+		RouterInbound = 0,
+		InboundDelivered,
+		Decoded,
+		Filtered,
+		Encoded,
+		RouterOutbound,
+		OutboundDelivered,
+		PublisherDequeued,
+		Published,
+
+		NumberOfPoints
+	};
+
+	static constexpr size_t NumberOfPoints = static_cast<size_t>(Point::NumberOfPoints);
+
+	static int64_t GetCurrentTimeUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// The name of the stage that ends at the point
+	static const char *StringFromPoint(Point point)
+	{
+		switch (point)
+		{
+			case Point::RouterInbound:
+				return "ingest";
+			case Point::InboundDelivered:
+				return "inboundQueue";
+			case Point::Decoded:
+				return "decode";
+			case Point::Filtered:
+				return "filter";
+			case Point::Encoded:
+				return "encode";
+			case Point::RouterOutbound:
+				return "transcoderOutput";
+			case Point::OutboundDelivered:
+				return "outboundQueue";
+			case Point::PublisherDequeued:
+				return "publisherQueue";
+			case Point::Published:
+				return "publish";
+			case Point::NumberOfPoints:
+				break;
+		}
+
+		return "unknown";
+	}
+
+	void Mark(Point point)
+	{
+		Mark(point, GetCurrentTimeUs());
+	}
+
+	void Mark(Point point, int64_t time_us)
+	{
+		_timestamps[static_cast<size_t>(point)] = time_us;
+	}
+
+	// Returns 0 if the packet has not passed the point
+	int64_t GetTimestamp(Point point) const
+	{
+		return _timestamps[static_cast<size_t>(point)];
+	}
+
+	// A cloned packet goes through its own path, so it has its own trace
+	std::shared_ptr<MediaTrace> Clone() const
+	{
+		return std::make_shared<MediaTrace>(*this);
+	}
+
+private:
+	std::array<int64_t, NumberOfPoints> _timestamps{};
+};
+
+// Keeps the traces of the inputs of components until the outputs with the same timestamp come out.
+// A component (decoder, filter, encoder) creates a new packet/frame, so the trace cannot be carried by the input itself.
+class MediaTraceMap
+{
+public:
+	void Push(int32_t component_id, int64_t timestamp, const std::shared_ptr<MediaTrace> &trace)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		if (_items.size() >= MEDIA_TRACE_MAP_MAX_SIZE)
+		{
+			_items.pop_front();
+		}
+
+		_items.push_back({component_id, timestamp, trace});
+		_count = _items.size();
+	}
+
+	// Finds the trace of the input whose timestamp is within the tolerance of the output
+	std::shared_ptr<MediaTrace> Pop(int32_t component_id, int64_t timestamp, int64_t tolerance = 0)
+	{
+		// Most packets are not traced, so this must be cheap
+		if (IsEmpty())
+		{
+			return nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		for (auto it = _items.begin(); it != _items.end(); ++it)
+		{
+			if ((it->component_id != component_id) || (std::abs(it->timestamp - timestamp) > tolerance))
+			{
+				continue;
+			}
+
+			auto trace = it->trace;
+
+			_items.erase(it);
+			_count = _items.size();
+
+			return trace;
+		}
+
+		return nullptr;
+	}
+
+	bool IsEmpty() const
+	{
+		return _count.load(std::memory_order_relaxed) == 0;
+	}
+
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		_items.clear();
+		_count = 0;
+	}
+
+private:
+	struct Item
+	{
+		int32_t component_id;
+		int64_t timestamp;
+		std::shared_ptr<MediaTrace> trace;
+	};
+
+	std::mutex _mutex;
+	std::deque<Item> _items;
+	std::atomic<size_t> _count{0};
+};
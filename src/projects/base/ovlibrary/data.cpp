@@ -52,7 +52,7 @@ namespace ov
 		_reference_data = data._reference_data;
 		if (data._allocated_data != nullptr)
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			_allocated_data = std::allocate_shared<Buffer>(DataPoolAllocator<Buffer>());
 			Append(&data);
 		}
 		_offset = data._offset;
@@ -257,7 +257,7 @@ namespace ov
 		// Reset the offset
 		_offset = 0L;
 
-		_allocated_data = std::make_shared<std::vector<uint8_t>>(begin, end);
+		_allocated_data = std::allocate_shared<Buffer>(DataPoolAllocator<Buffer>(), begin, end);
 		_allocated_data->reserve(old_data->capacity() - old_offset);
 
 		return (_allocated_data != nullptr);
@@ -276,7 +276,7 @@ namespace ov
 		}
 		else
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			_allocated_data = std::allocate_shared<Buffer>(DataPoolAllocator<Buffer>());
 		}
 
 		_allocated_data->reserve(capacity);
@@ -288,7 +288,7 @@ namespace ov
 	{
 		// Reallocate the buffer (this method is faster than Detach() & clear());
 		_reference_data = nullptr;
-		_allocated_data = std::make_shared<std::vector<uint8_t>>();
+		_allocated_data = std::allocate_shared<Buffer>(DataPoolAllocator<Buffer>());
 		_offset = 0;
 		_length = 0;
 
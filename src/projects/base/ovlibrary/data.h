@@ -12,6 +12,7 @@
 #include "./assert.h"
 #include "./memory_utilities.h"
 #include "./data.h"
+#include "./data_pool.h"
 
 #include <memory>
 #include <algorithm>
@@ -22,6 +23,9 @@ namespace ov
 	class Data
 	{
 	public:
+		// The backing store is allocated from DataPool to reuse the memory of short-lived packets
+		using Buffer = std::vector<uint8_t, DataPoolAllocator<uint8_t>>;
+
 		// Default constructor
 		Data();
 
@@ -217,7 +221,7 @@ namespace ov
 		const void *_reference_data = nullptr;
 
 		// Allocated data. If this data is subdata, _current_data and _data can be different.
-		std::shared_ptr<std::vector<uint8_t>> _allocated_data = nullptr;
+		std::shared_ptr<Buffer> _allocated_data = nullptr;
 		// Offset from _allocated_data
 		off_t _offset = 0;
 
@@ -0,0 +1,350 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "data_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+#include "monitoring/sharded_counters.h"
+
+namespace ov
+{
+	namespace
+	{
+		// Indices of the counters of a size class
+		constexpr size_t AllocationCounter = 0;
+		constexpr size_t HitCounter = 1;
+		constexpr size_t InUseCounter = 2;
+		constexpr size_t ReservedBytesCounter = 3;
+		constexpr size_t CounterCount = 4;
+
+		struct SizeClass
+		{
+			SizeClass(size_t block_size, size_t slab_size, size_t thread_cache_limit, size_t global_cache_limit)
+				: block_size(block_size),
+				  slab_size(slab_size),
+				  thread_cache_limit(thread_cache_limit),
+				  global_cache_limit(global_cache_limit)
+			{
+			}
+
+			const size_t block_size;
+			// 0 means that each block is allocated from the heap separately (it can be returned to the heap)
+			const size_t slab_size;
+			// The number of free blocks that a thread can keep
+			const size_t thread_cache_limit;
+			// The number of free blocks kept in the global free list (used only when slab_size is 0)
+			const size_t global_cache_limit;
+
+			std::mutex mutex;
+			std::vector<void *> free_blocks;
+
+			// Updated by every allocation/deallocation of all threads, so they are sharded
+			mon::ShardedCounters<CounterCount> counters;
+		};
+
+		// Block sizes must be multiples of alignof(std::max_align_t) because they are carved from a slab
+		//
+		//    64: Control blocks of std::shared_ptr, small RTCP/STUN payloads
+		//   256: Audio frames, RTCP compound packets
+		//  1328: 7 MPEG-TS packets (188 * 7 = 1316) used by SRT/UDP
+		//  1536: A RTP packet/UDP datagram up to MTU (1500)
+		//  4096: Audio frames and small video frames
+		// 16384: P-frames
+		// 65536 ~ 1MB: I-frames and fragments of LL-HLS/DASH
+		constexpr size_t SizeClassCount = 9;
+
+		struct SizeClassTable
+		{
+			SizeClassTable()
+				: classes{{{64, 256 * 1024, 256, 0},
+						   {256, 256 * 1024, 256, 0},
+						   {1328, 256 * 1024, 256, 0},
+						   {1536, 256 * 1024, 256, 0},
+						   {4096, 256 * 1024, 64, 0},
+						   {16384, 256 * 1024, 32, 0},
+						   {65536, 0, 8, 64},
+						   {262144, 0, 4, 32},
+						   {1048576, 0, 2, 16}}}
+			{
+			}
+
+			std::array<SizeClass, SizeClassCount> classes;
+
+			// Blocks larger than the largest size class
+			mon::ShardedCounters<CounterCount> oversized_counters;
+		};
+
+		SizeClassTable &GetSizeClassTable()
+		{
+			// Intentionally leaked: ov::Data instances in static storage may be released after this table
+			static auto table = new SizeClassTable();
+			return *table;
+		}
+
+		int GetSizeClassIndex(size_t size)
+		{
+			auto &classes = GetSizeClassTable().classes;
+
+			for (size_t index = 0; index < SizeClassCount; index++)
+			{
+				if (size <= classes[index].block_size)
+				{
+					return static_cast<int>(index);
+				}
+			}
+
+			return -1;
+		}
+
+		void *AllocateFromHeap(size_t size)
+		{
+			auto pointer = ::malloc(size);
+
+			if (pointer == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+			return pointer;
+		}
+
+		// Moves free blocks of the thread cache to the global free list of the size class
+		void ReleaseToGlobal(SizeClass &size_class, std::vector<void *> &blocks, size_t count)
+		{
+			std::vector<void *> blocks_to_free;
+
+			{
+				std::lock_guard<std::mutex> lock_guard(size_class.mutex);
+
+				for (size_t index = 0; index < count; index++)
+				{
+					auto block = blocks.back();
+					blocks.pop_back();
+
+					if ((size_class.slab_size == 0) && (size_class.free_blocks.size() >= size_class.global_cache_limit))
+					{
+						blocks_to_free.push_back(block);
+					}
+					else
+					{
+						size_class.free_blocks.push_back(block);
+					}
+				}
+			}
+
+			for (auto block : blocks_to_free)
+			{
+				size_class.counters.Subtract(ReservedBytesCounter, size_class.block_size);
+				::free(block);
+			}
+		}
+
+		// This is trivially destructible, so it is safe to access even after ThreadCache is destroyed
+		thread_local bool thread_cache_destroyed = false;
+
+		struct ThreadCache
+		{
+			~ThreadCache()
+			{
+				thread_cache_destroyed = true;
+
+				auto &classes = GetSizeClassTable().classes;
+
+				for (size_t index = 0; index < SizeClassCount; index++)
+				{
+					ReleaseToGlobal(classes[index], blocks[index], blocks[index].size());
+				}
+			}
+
+			std::array<std::vector<void *>, SizeClassCount> blocks;
+		};
+
+		ThreadCache *GetThreadCache()
+		{
+			if (thread_cache_destroyed)
+			{
+				// ov::Data is released in the destructor of another thread_local object
+				return nullptr;
+			}
+
+			thread_local ThreadCache cache;
+			return &cache;
+		}
+
+		void *AllocateFromClass(SizeClass &size_class, std::vector<void *> *cache_blocks)
+		{
+			size_class.counters.Add(AllocationCounter, 1);
+			size_class.counters.Add(InUseCounter, 1);
+
+			if ((cache_blocks != nullptr) && (cache_blocks->empty() == false))
+			{
+				auto block = cache_blocks->back();
+				cache_blocks->pop_back();
+
+				size_class.counters.Add(HitCounter, 1);
+				return block;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock_guard(size_class.mutex);
+				auto &free_blocks = size_class.free_blocks;
+
+				if (free_blocks.empty() == false)
+				{
+					auto block = free_blocks.back();
+					free_blocks.pop_back();
+
+					if (cache_blocks != nullptr)
+					{
+						// Take a batch to avoid locking the global free list for the next allocations
+						size_t count = std::min(free_blocks.size(), size_class.thread_cache_limit / 2);
+						cache_blocks->insert(cache_blocks->end(), free_blocks.end() - count, free_blocks.end());
+						free_blocks.resize(free_blocks.size() - count);
+					}
+
+					size_class.counters.Add(HitCounter, 1);
+					return block;
+				}
+			}
+
+			if (size_class.slab_size == 0)
+			{
+				size_class.counters.Add(ReservedBytesCounter, size_class.block_size);
+				return AllocateFromHeap(size_class.block_size);
+			}
+
+			// Carve a new slab into blocks
+			auto slab = static_cast<uint8_t *>(AllocateFromHeap(size_class.slab_size));
+			size_t block_count = size_class.slab_size / size_class.block_size;
+			size_class.counters.Add(ReservedBytesCounter, size_class.slab_size);
+
+			if (cache_blocks != nullptr)
+			{
+				for (size_t index = 1; index < block_count; index++)
+				{
+					cache_blocks->push_back(slab + (index * size_class.block_size));
+				}
+
+				if (cache_blocks->size() > size_class.thread_cache_limit)
+				{
+					ReleaseToGlobal(size_class, *cache_blocks, cache_blocks->size() - size_class.thread_cache_limit);
+				}
+			}
+			else
+			{
+				std::lock_guard<std::mutex> lock_guard(size_class.mutex);
+
+				for (size_t index = 1; index < block_count; index++)
+				{
+					size_class.free_blocks.push_back(slab + (index * size_class.block_size));
+				}
+			}
+
+			return slab;
+		}
+	}  // namespace
+
+	void *DataPool::Allocate(size_t size)
+	{
+		auto &table = GetSizeClassTable();
+		auto index = GetSizeClassIndex(size);
+
+		if (index < 0)
+		{
+			table.oversized_counters.Add(AllocationCounter, 1);
+			table.oversized_counters.Add(InUseCounter, 1);
+			table.oversized_counters.Add(ReservedBytesCounter, size);
+
+			return AllocateFromHeap(size);
+		}
+
+		auto cache = GetThreadCache();
+
+		return AllocateFromClass(table.classes[index], (cache != nullptr) ? &(cache->blocks[index]) : nullptr);
+	}
+
+	void DataPool::Free(void *pointer, size_t size) noexcept
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+
+		auto &table = GetSizeClassTable();
+		auto index = GetSizeClassIndex(size);
+
+		if (index < 0)
+		{
+			table.oversized_counters.Subtract(InUseCounter, 1);
+			table.oversized_counters.Subtract(ReservedBytesCounter, size);
+
+			::free(pointer);
+			return;
+		}
+
+		auto &size_class = table.classes[index];
+		size_class.counters.Subtract(InUseCounter, 1);
+
+		auto cache = GetThreadCache();
+
+		if (cache == nullptr)
+		{
+			std::vector<void *> blocks{pointer};
+			ReleaseToGlobal(size_class, blocks, 1);
+			return;
+		}
+
+		auto &cache_blocks = cache->blocks[index];
+		cache_blocks.push_back(pointer);
+
+		if (cache_blocks.size() > size_class.thread_cache_limit)
+		{
+			// Keep the half of the cache to avoid moving blocks back and forth
+			ReleaseToGlobal(size_class, cache_blocks, cache_blocks.size() - (size_class.thread_cache_limit / 2));
+		}
+	}
+
+	std::vector<DataPoolStatistics> DataPool::GetStatistics()
+	{
+		auto &table = GetSizeClassTable();
+		std::vector<DataPoolStatistics> statistics_list;
+
+		for (auto &size_class : table.classes)
+		{
+			DataPoolStatistics statistics;
+
+			statistics.block_size = size_class.block_size;
+			statistics.allocation_count = size_class.counters.Get(AllocationCounter);
+			statistics.hit_count = size_class.counters.Get(HitCounter);
+			statistics.in_use_count = static_cast<int64_t>(size_class.counters.Get(InUseCounter));
+			statistics.reserved_bytes = size_class.counters.Get(ReservedBytesCounter);
+
+			{
+				std::lock_guard<std::mutex> lock_guard(size_class.mutex);
+				statistics.cached_count = size_class.free_blocks.size();
+			}
+
+			statistics_list.push_back(statistics);
+		}
+
+		DataPoolStatistics oversized;
+
+		oversized.allocation_count = table.oversized_counters.Get(AllocationCounter);
+		oversized.in_use_count = static_cast<int64_t>(table.oversized_counters.Get(InUseCounter));
+		oversized.reserved_bytes = table.oversized_counters.Get(ReservedBytesCounter);
+
+		statistics_list.push_back(oversized);
+
+		return statistics_list;
+	}
+}  // namespace ov
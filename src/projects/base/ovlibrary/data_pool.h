@@ -0,0 +1,88 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace ov
+{
+	struct DataPoolStatistics
+	{
+		// 0 means the blocks larger than the largest size class (allocated from the heap directly)
+		size_t block_size = 0;
+
+		// The number of blocks requested
+		uint64_t allocation_count = 0;
+		// The number of blocks served from the thread cache or the global free list
+		uint64_t hit_count = 0;
+		// The number of blocks currently used by ov::Data
+		int64_t in_use_count = 0;
+		// The number of free blocks in the global free list (thread caches are not included)
+		size_t cached_count = 0;
+		// The total bytes of slabs/blocks obtained from the heap
+		uint64_t reserved_bytes = 0;
+	};
+
+	// A size-class slab allocator for the backing store of ov::Data.
+	//
+	// Each thread keeps a small cache of free blocks per size class, so most of the allocations/deallocations
+	// in the media path do not need any lock. When a thread cache is empty or full,
+	// blocks are moved from/to the global free list of the size class in batches.
+	//
+	// Small blocks are carved from slabs that are never returned to the heap,
+	// so the memory of the pool is bounded by the peak usage and the heap is not fragmented by short-lived packets.
+	class DataPool
+	{
+	public:
+		static void *Allocate(size_t size);
+		static void Free(void *pointer, size_t size) noexcept;
+
+		static std::vector<DataPoolStatistics> GetStatistics();
+	};
+
+	// STL allocator that allocates from DataPool
+	template <typename T>
+	class DataPoolAllocator
+	{
+	public:
+		using value_type = T;
+
+		DataPoolAllocator() noexcept = default;
+
+		template <typename U>
+		DataPoolAllocator(const DataPoolAllocator<U> &) noexcept
+		{
+		}
+
+		T *allocate(size_t count)
+		{
+			return static_cast<T *>(DataPool::Allocate(count * sizeof(T)));
+		}
+
+		void deallocate(T *pointer, size_t count) noexcept
+		{
+			DataPool::Free(pointer, count * sizeof(T));
+		}
+
+		template <typename U>
+		bool operator==(const DataPoolAllocator<U> &) const noexcept
+		{
+			return true;
+		}
+
+		template <typename U>
+		bool operator!=(const DataPoolAllocator<U> &) const noexcept
+		{
+			return false;
+		}
+	};
+}  // namespace ov
@@ -0,0 +1,98 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "file_region.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "./log.h"
+
+#define OV_LOG_TAG "FileRegion"
+
+namespace ov
+{
+	std::shared_ptr<FileRegion> FileRegion::Open(const String &file_path)
+	{
+		int fd = ::open(file_path.CStr(), O_RDONLY | O_CLOEXEC);
+
+		if (fd < 0)
+		{
+			logte("Could not open file: %s (%s)", file_path.CStr(), ::strerror(errno));
+			return nullptr;
+		}
+
+		struct stat file_stat;
+
+		if (::fstat(fd, &file_stat) != 0)
+		{
+			logte("Could not get the size of file: %s (%s)", file_path.CStr(), ::strerror(errno));
+			::close(fd);
+			return nullptr;
+		}
+
+		return std::make_shared<FileRegion>(fd, 0, file_stat.st_size);
+	}
+
+	FileRegion::FileRegion(int fd, off_t offset, size_t length)
+		: _fd(fd),
+		  _offset(offset),
+		  _length(length)
+	{
+	}
+
+	FileRegion::~FileRegion()
+	{
+		if (_fd >= 0)
+		{
+			::close(_fd);
+		}
+	}
+
+	std::shared_ptr<Data> FileRegion::Read(off_t offset, size_t length) const
+	{
+		if ((offset < 0) || (static_cast<size_t>(offset) + length > _length))
+		{
+			return nullptr;
+		}
+
+		auto data = std::make_shared<Data>(length);
+		data->SetLength(length);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		size_t read_bytes = 0;
+
+		while (read_bytes < length)
+		{
+			auto result = ::pread(_fd, buffer + read_bytes, length - read_bytes, _offset + offset + read_bytes);
+
+			if (result < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				logte("Could not read file (fd: %d, offset: %lld): %s", _fd, static_cast<long long>(_offset + offset + read_bytes), ::strerror(errno));
+				return nullptr;
+			}
+
+			if (result == 0)
+			{
+				// The file is truncated
+				logte("Unexpected end of file (fd: %d, offset: %lld)", _fd, static_cast<long long>(_offset + offset + read_bytes));
+				return nullptr;
+			}
+
+			read_bytes += result;
+		}
+
+		return data;
+	}
+}  // namespace ov
@@ -0,0 +1,57 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <sys/types.h>
+
+#include <memory>
+
+#include "./data.h"
+#include "./string.h"
+
+namespace ov
+{
+	// A read-only region of an opened file.
+	// The file descriptor is kept opened while the instance is alive, so the region can still be read after the file is deleted.
+	//
+	// It is used to send a file without loading it into memory (sendfile() for plain TCP, pread() for TLS/HTTP2).
+	class FileRegion
+	{
+	public:
+		// Opens the whole file
+		static std::shared_ptr<FileRegion> Open(const String &file_path);
+
+		FileRegion(int fd, off_t offset, size_t length);
+		~FileRegion();
+
+		int GetNativeHandle() const
+		{
+			return _fd;
+		}
+
+		off_t GetOffset() const
+		{
+			return _offset;
+		}
+
+		size_t GetLength() const
+		{
+			return _length;
+		}
+
+		// Reads <length> bytes from <offset> of the region (pread)
+		// Returns nullptr if an error occurs
+		std::shared_ptr<Data> Read(off_t offset, size_t length) const;
+
+	protected:
+		int _fd = -1;
+		off_t _offset = 0;
+		size_t _length = 0;
+	};
+}  // namespace ov
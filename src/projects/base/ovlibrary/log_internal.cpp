@@ -8,6 +8,8 @@
 //==============================================================================
 #include "log_internal.h"
 
+#include <unistd.h>
+
 #include <thread>
 
 #include "platform.h"
@@ -332,21 +334,16 @@ namespace ov
 
 		// Append messages
 		log.AppendVFormat(format, arg_list);
+
+		// The console is written by the writer thread too, so the caller doesn't wait for the terminal
 		if (show_format)
 		{
-			if (level < OVLogLevelWarning)
-			{
-				fprintf(stdout, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				fflush(stdout);
-			}
-			else
-			{
-				fprintf(stderr, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				fflush(stderr);
-			}
+			_log_file.Write(log.CStr(), 0, (level < OVLogLevelWarning) ? STDOUT_FILENO : STDERR_FILENO, color_prefix[level], color_suffix[level]);
+		}
+		else
+		{
+			_log_file.Write(log.CStr());
 		}
-
-		_log_file.Write(log.CStr());
 	}
 
 	void LogInternal::SetLogPath(const char *log_path)
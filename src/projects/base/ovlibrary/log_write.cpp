@@ -7,115 +7,448 @@
 //
 //==============================================================================
 
-#include <iostream>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
 #include <iomanip>
+#include <iostream>
 #include <memory>
 #include <sstream>
-#include <sys/stat.h>
 
 #include "log_write.h"
 
+static_assert((OV_LOG_WRITE_QUEUE_SIZE & (OV_LOG_WRITE_QUEUE_SIZE - 1)) == 0, "OV_LOG_WRITE_QUEUE_SIZE must be a power of 2");
+static_assert(OV_LOG_WRITE_BATCH_SIZE <= IOV_MAX, "OV_LOG_WRITE_BATCH_SIZE must not exceed IOV_MAX");
+
 namespace ov
 {
-    bool LogWrite::_start_service = false;
-
-    LogWrite::LogWrite(std::string log_file_name, bool include_date_in_filename) :
-        _last_day(0),
-        _log_path(OV_LOG_DIR)
-    {
-        if(log_file_name.empty())
-        {
-            _log_file_name = OV_DEFAULT_LOG_FILE;
-        }
-        else
-        {
-            _log_file_name = log_file_name;
-        }
-
-        _log_file = _log_path + std::string("/") + log_file_name;
+	std::atomic<bool> LogWrite::_start_service{false};
+	std::atomic<uint32_t> LogWrite::_fork_generation{0};
+
+	LogWrite::LogWrite(std::string log_file_name, bool include_date_in_filename)
+		: _entries(new Entry[OV_LOG_WRITE_QUEUE_SIZE]),
+		  _last_day(0),
+		  _log_path(OV_LOG_DIR)
+	{
+		for (size_t index = 0; index < OV_LOG_WRITE_QUEUE_SIZE; index++)
+		{
+			_entries[index].sequence.store(index, std::memory_order_relaxed);
+		}
+
+		if (log_file_name.empty())
+		{
+			_log_file_name = OV_DEFAULT_LOG_FILE;
+		}
+		else
+		{
+			_log_file_name = log_file_name;
+		}
+
+		_log_file = _log_path + std::string("/") + log_file_name;
 		_include_date_in_filename = include_date_in_filename;
-    }
+	}
 
-    void LogWrite::SetLogPath(const char* log_path)
-    {
-        _log_path = log_path;
-        _log_file = log_path + std::string("/") + _log_file_name;
-    }
+	LogWrite::~LogWrite()
+	{
+		if ((_writer_thread != nullptr) && (_writer_generation == _fork_generation))
+		{
+			// The writer thread writes all the queued logs before exiting
+			_writer_stop = true;
+			_writer_condition.notify_all();
+
+			if (_writer_thread->joinable())
+			{
+				_writer_thread->join();
+			}
+		}
+
+		CloseFile();
+	}
+
+	void LogWrite::SetLogPath(const char *log_path)
+	{
+		std::lock_guard<std::mutex> lock_guard(_log_file_mutex);
+
+		_log_path = log_path;
+		_log_file = log_path + std::string("/") + _log_file_name;
+
+		// The writer thread opens the file of the new path
+		_reopen = true;
+	}
+
+	void LogWrite::OpenNewFile(std::time_t time)
+	{
+		if (_start_service.exchange(false))
+		{
+			// Change default log path to /var once for running service
+			_log_path = OV_LOG_DIR_SVC;
+			_log_file = _log_path + std::string("/") + _log_file_name;
+		}
 
-    void LogWrite::OpenNewFile(std::time_t time)
-    {
-        if (_start_service)
-        {
-            SetLogPath(OV_LOG_DIR_SVC);
+		_reopen = false;
 
-            // Change default log path to /var once for running service
-            _start_service = false;
-        }
+		if ((::mkdir(_log_path.c_str(), 0755) == -1) && errno != EEXIST)
+		{
+			return;
+		}
 
-        if ((::mkdir(_log_path.c_str(), 0755) == -1) && errno != EEXIST)
-        {
-            return;
-        }
+		CloseFile();
 
-        std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-        _log_stream.close();
-        _log_stream.clear();
+		std::string log_file = _log_file;
 
-		if(_include_date_in_filename == true)
+		if (_include_date_in_filename == true)
 		{
-			std::tm local_time {};
-        	::localtime_r(&time, &local_time);
+			std::tm local_time{};
+			::localtime_r(&time, &local_time);
 			std::ostringstream logfile;
-            logfile << _log_file << "." << std::put_time(&local_time, "%Y%m%d");
-			_log_stream.open(logfile.str().c_str(), std::ofstream::out | std::ofstream::app);
+			logfile << _log_file << "." << std::put_time(&local_time, "%Y%m%d");
+			log_file = logfile.str();
 		}
-		else
+
+		_log_fd = ::open(log_file.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	}
+
+	void LogWrite::CloseFile()
+	{
+		if (_log_fd >= 0)
 		{
-        	_log_stream.open(_log_file, std::ofstream::out | std::ofstream::app);
+			::close(_log_fd);
+			_log_fd = -1;
 		}
-    }
+	}
 
-    void LogWrite::SetAsService(bool start_service)
-    {
-        _start_service = start_service;
-    }
+	void LogWrite::SetAsService(bool start_service)
+	{
+		_start_service = start_service;
+	}
 
-    void LogWrite::Write(const char *log, std::time_t time)
-    {
-    	if(time == 0)
+	void LogWrite::Write(const char *log, std::time_t time, int console_fd, const char *console_prefix, const char *console_suffix)
+	{
+		if (time == 0)
 		{
 			time = std::time(nullptr);
 		}
-        std::tm local_time {};
-        ::localtime_r(&time, &local_time);
-
-		if (!_log_stream.is_open() || _log_stream.fail())
-        {
-            OpenNewFile(time);
-        }
-        
-		// Need to open new file?
-		if (_last_day != local_time.tm_mday)
-        {
-			// Not first
-            if (_last_day != 0)
-            {
-				if(_include_date_in_filename == false)
+
+		if (_writer_generation.load(std::memory_order_relaxed) != _fork_generation.load(std::memory_order_relaxed))
+		{
+			StartWriterThread();
+		}
+
+		if (Enqueue(log, time, console_fd, console_prefix, console_suffix) == false)
+		{
+			// The queue is full. Drop the log rather than blocking the caller
+			_dropped_count++;
+			return;
+		}
+
+		if (_writer_waiting)
+		{
+			_writer_condition.notify_one();
+		}
+	}
+
+	bool LogWrite::Enqueue(const char *log, std::time_t time, int console_fd, const char *console_prefix, const char *console_suffix)
+	{
+		size_t position = _enqueue_pos.load(std::memory_order_relaxed);
+		Entry *entry = nullptr;
+
+		while (true)
+		{
+			entry = &_entries[position & (OV_LOG_WRITE_QUEUE_SIZE - 1)];
+
+			auto sequence = entry->sequence.load(std::memory_order_acquire);
+			auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (diff == 0)
+			{
+				// The slot is empty. Try to take it
+				if (_enqueue_pos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				// The writer thread has not consumed this slot yet
+				return false;
+			}
+			else
+			{
+				// Another producer took the slot
+				position = _enqueue_pos.load(std::memory_order_relaxed);
+			}
+		}
+
+		entry->time = time;
+		entry->log.assign(log);
+		entry->log.push_back('\n');
+
+		entry->console_fd = console_fd;
+		if (console_fd >= 0)
+		{
+			entry->console_log.assign(console_prefix);
+			entry->console_log.append(log);
+			entry->console_log.append(console_suffix);
+			entry->console_log.push_back('\n');
+		}
+
+		// Publish the slot to the writer thread
+		entry->sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	bool LogWrite::IsQueueEmpty() const
+	{
+		auto &entry = _entries[_dequeue_pos & (OV_LOG_WRITE_QUEUE_SIZE - 1)];
+
+		return entry.sequence.load(std::memory_order_acquire) != (_dequeue_pos + 1);
+	}
+
+	void LogWrite::StartWriterThread()
+	{
+		static std::once_flag fork_handler_flag;
+
+		std::call_once(fork_handler_flag, []() {
+			// The writer thread doesn't exist in the child process. It is started again by the next log
+			::pthread_atfork(nullptr, nullptr, []() { _fork_generation++; });
+		});
+
+		std::lock_guard<std::mutex> lock_guard(_writer_mutex);
+
+		auto generation = _fork_generation.load();
+
+		if (_writer_generation == generation)
+		{
+			// Started by another thread
+			return;
+		}
+
+		if (_writer_thread != nullptr)
+		{
+			// This is the thread object of the parent process, so it cannot be joined
+			_writer_thread.release();
+		}
+
+		_writer_stop = false;
+		_writer_thread = std::make_unique<std::thread>(&LogWrite::WriterThread, this);
+		::pthread_setname_np(_writer_thread->native_handle(), "LogWriter");
+
+		_writer_generation = generation;
+	}
+
+	void LogWrite::WriterThread()
+	{
+		while (true)
+		{
+			if (WriteQueuedLogs() > 0)
+			{
+				continue;
+			}
+
+			WriteDroppedCount();
+
+			if (_writer_stop)
+			{
+				break;
+			}
+
+			std::unique_lock<std::mutex> lock(_writer_mutex);
+
+			_writer_waiting = true;
+			_writer_condition.wait_for(lock, std::chrono::milliseconds(OV_LOG_WRITE_INTERVAL_MS), [this]() -> bool {
+				return _writer_stop || (IsQueueEmpty() == false);
+			});
+			_writer_waiting = false;
+		}
+	}
+
+	size_t LogWrite::WriteQueuedLogs()
+	{
+		struct iovec iov[OV_LOG_WRITE_BATCH_SIZE];
+		int iov_count = 0;
+		size_t written_count = 0;
+
+		std::lock_guard<std::mutex> lock_guard(_log_file_mutex);
+
+		while (true)
+		{
+			size_t position = _dequeue_pos + iov_count;
+			auto &entry = _entries[position & (OV_LOG_WRITE_QUEUE_SIZE - 1)];
+
+			bool is_ready = (entry.sequence.load(std::memory_order_acquire) == (position + 1)) && (iov_count < OV_LOG_WRITE_BATCH_SIZE);
+			int day = 0;
+			bool need_open = false;
+
+			if (is_ready)
+			{
+				// Most logs have the same time as the previous one
+				if (entry.time != _last_time)
+				{
+					std::tm local_time{};
+					::localtime_r(&entry.time, &local_time);
+
+					_last_time = entry.time;
+					_last_time_day = local_time.tm_mday;
+				}
+				day = _last_time_day;
+
+				need_open = (_log_fd < 0) || _reopen || (_last_day != day);
+
+				if (need_open == false)
+				{
+					iov[iov_count].iov_base = entry.log.data();
+					iov[iov_count].iov_len = entry.log.size();
+					iov_count++;
+					continue;
+				}
+			}
+
+			// Write the collected logs before opening a new file
+			if (iov_count > 0)
+			{
+				WriteConsoleLogs(_dequeue_pos, iov_count);
+				WriteFully(_log_fd, iov, iov_count);
+
+				for (int index = 0; index < iov_count; index++)
+				{
+					_entries[(_dequeue_pos + index) & (OV_LOG_WRITE_QUEUE_SIZE - 1)].sequence.store(_dequeue_pos + index + OV_LOG_WRITE_QUEUE_SIZE, std::memory_order_release);
+				}
+
+				_dequeue_pos += iov_count;
+				written_count += iov_count;
+				iov_count = 0;
+			}
+
+			if (need_open == false)
+			{
+				break;
+			}
+
+			// Need to open new file?
+			if ((_last_day != 0) && (_last_day != day) && (_include_date_in_filename == false))
+			{
+				// Backup file to (filename.log.yymmdd)
+				std::tm local_time{};
+				::localtime_r(&entry.time, &local_time);
+
+				std::ostringstream logfile;
+				logfile << _log_file << "." << std::put_time(&local_time, "%Y%m%d");
+				::rename(_log_file.c_str(), logfile.str().c_str());
+			}
+
+			OpenNewFile(entry.time);
+			_last_day = day;
+
+			if (_log_fd < 0)
+			{
+				// Could not open the file. Discard the log, and try again with the next log
+				WriteConsoleLogs(_dequeue_pos, 1);
+				entry.sequence.store(_dequeue_pos + OV_LOG_WRITE_QUEUE_SIZE, std::memory_order_release);
+				_dequeue_pos++;
+				written_count++;
+			}
+		}
+
+		return written_count;
+	}
+
+	void LogWrite::WriteDroppedCount()
+	{
+		uint64_t dropped_count = _dropped_count;
+
+		if (dropped_count == _reported_dropped_count)
+		{
+			return;
+		}
+
+		std::ostringstream message;
+		message << "[LogWrite] " << (dropped_count - _reported_dropped_count) << " logs were dropped because the log queue was full (total: " << dropped_count << ")\n";
+		_reported_dropped_count = dropped_count;
+
+		auto log = message.str();
+		struct iovec iov = {log.data(), log.size()};
+
+		std::lock_guard<std::mutex> lock_guard(_log_file_mutex);
+		WriteFully(_log_fd, &iov, 1);
+	}
+
+	void LogWrite::WriteConsoleLogs(size_t position, int count)
+	{
+		struct iovec iov[OV_LOG_WRITE_BATCH_SIZE];
+		int iov_count = 0;
+		int fd = -1;
+
+		for (int index = 0; index < count; index++)
+		{
+			auto &entry = _entries[(position + index) & (OV_LOG_WRITE_QUEUE_SIZE - 1)];
+
+			if (entry.console_fd < 0)
+			{
+				continue;
+			}
+
+			// stdout and stderr are written separately, so the logs are written in order per fd
+			if ((iov_count > 0) && (entry.console_fd != fd))
+			{
+				WriteFully(fd, iov, iov_count);
+				iov_count = 0;
+			}
+
+			fd = entry.console_fd;
+			iov[iov_count].iov_base = entry.console_log.data();
+			iov[iov_count].iov_len = entry.console_log.size();
+			iov_count++;
+		}
+
+		if (iov_count > 0)
+		{
+			WriteFully(fd, iov, iov_count);
+		}
+	}
+
+	bool LogWrite::WriteFully(int fd, struct iovec *iov, int iov_count)
+	{
+		if (fd < 0)
+		{
+			return false;
+		}
+
+		while (iov_count > 0)
+		{
+			auto result = ::writev(fd, iov, iov_count);
+
+			if (result < 0)
+			{
+				if (errno == EINTR)
 				{
-					// Backup file to (filename.log.yymmdd)
-					std::ostringstream logfile;
-					logfile << _log_file << "." << std::put_time(&local_time, "%Y%m%d");
-					::rename(_log_file.c_str(), logfile.str().c_str());
+					continue;
 				}
 
-				// Open new file (filename.log.yymmdd)
-				OpenNewFile(time);
-            }
-            _last_day = local_time.tm_mday;
-        }
-
-        std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-        _log_stream << log << std::endl;
-        _log_stream.flush();
-    }
-}
\ No newline at end of file
+				return false;
+			}
+
+			// Skip the written buffers
+			size_t written_bytes = result;
+
+			while ((iov_count > 0) && (written_bytes >= iov->iov_len))
+			{
+				written_bytes -= iov->iov_len;
+				iov++;
+				iov_count--;
+			}
+
+			if (iov_count > 0)
+			{
+				iov->iov_base = static_cast<uint8_t *>(iov->iov_base) + written_bytes;
+				iov->iov_len -= written_bytes;
+			}
+		}
+
+		return true;
+	}
+}
@@ -8,35 +8,107 @@
 //==============================================================================
 #pragma once
 
-#include <fstream>
+#include <sys/uio.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
 
 #define OV_LOG_DIR              "logs"
 #define OV_LOG_DIR_SVC          "/var/log/ovenmediaengine"
 #define OV_DEFAULT_LOG_FILE     "ovenmediaengine.log"
+
+// The number of logs that can wait for the writer thread (must be a power of 2).
+// If the queue is full, the log is dropped instead of waiting.
+#define OV_LOG_WRITE_QUEUE_SIZE 16384
+// The maximum number of logs written with one writev() call
+#define OV_LOG_WRITE_BATCH_SIZE 64
+// The writer thread wakes up at least at this interval even if nobody notifies it
+#define OV_LOG_WRITE_INTERVAL_MS 100
+
 namespace ov
 {
-    class LogWrite
-    {
-    public:
-        LogWrite(std::string log_file_name, bool include_date_in_filename = false);
-        virtual ~LogWrite() = default;
-        void Write(const char* log, std::time_t time = 0);
-        void SetLogPath(const char* log_path);
-
-        static void SetAsService(bool start_service);
-
-    private:
-        void OpenNewFile(std::time_t time = 0);
-
-        std::mutex _log_stream_mutex;
-        std::ofstream _log_stream;
-        int _last_day;
-        std::string _log_path;
-        std::string _log_file_name;
-        std::string _log_file;
+	// Writes logs to a file (and the console) in a writer thread.
+	// Write() only copies the log into a lock-free MPSC queue, so the caller never waits for the file/console I/O.
+	// The writer thread collects the queued logs, writes them with writev(), and rotates the file.
+	class LogWrite
+	{
+	public:
+		LogWrite(std::string log_file_name, bool include_date_in_filename = false);
+		virtual ~LogWrite();
+		// If console_fd is not -1 (STDOUT_FILENO/STDERR_FILENO), the log is also written to the console, wrapped with console_prefix/console_suffix (e.g. colors)
+		void Write(const char *log, std::time_t time = 0, int console_fd = -1, const char *console_prefix = "", const char *console_suffix = "");
+		void SetLogPath(const char *log_path);
+
+		// The number of logs dropped because the queue was full
+		uint64_t GetDroppedCount() const
+		{
+			return _dropped_count;
+		}
+
+		static void SetAsService(bool start_service);
+
+	private:
+		struct Entry
+		{
+			std::atomic<size_t> sequence;
+			std::time_t time;
+			// The capacity is reused, so a slot doesn't allocate memory once it has been warmed up
+			std::string log;
+			// -1 if the log is not written to the console
+			int console_fd;
+			std::string console_log;
+		};
+
+		bool Enqueue(const char *log, std::time_t time, int console_fd, const char *console_prefix, const char *console_suffix);
+		bool IsQueueEmpty() const;
+
+		void StartWriterThread();
+		void WriterThread();
+		// Returns the number of logs written
+		size_t WriteQueuedLogs();
+		void WriteDroppedCount();
+		bool WriteFully(int fd, struct iovec *iov, int iov_count);
+		// Writes the console logs of the entries from the position in order
+		void WriteConsoleLogs(size_t position, int count);
+
+		void OpenNewFile(std::time_t time = 0);
+		void CloseFile();
+
+		// Queue
+		std::unique_ptr<Entry[]> _entries;
+		alignas(64) std::atomic<size_t> _enqueue_pos{0};
+		// Used only by the writer thread
+		alignas(64) size_t _dequeue_pos = 0;
+		std::atomic<uint64_t> _dropped_count{0};
+		uint64_t _reported_dropped_count = 0;
+
+		// Writer thread
+		std::mutex _writer_mutex;
+		std::condition_variable _writer_condition;
+		std::atomic<bool> _writer_waiting{false};
+		std::atomic<bool> _writer_stop{false};
+		// The thread is started by the first log, and is started again in the child process after fork()
+		std::unique_ptr<std::thread> _writer_thread;
+		std::atomic<uint32_t> _writer_generation{UINT32_MAX};
+
+		// File (used by the writer thread, and SetLogPath() under the mutex)
+		std::mutex _log_file_mutex;
+		int _log_fd = -1;
+		bool _reopen = false;
+		int _last_day;
+		std::time_t _last_time = 0;
+		int _last_time_day = 0;
+		std::string _log_path;
+		std::string _log_file_name;
+		std::string _log_file;
 		bool _include_date_in_filename = false;
-        static bool _start_service;
-    };
-}
 
+		static std::atomic<bool> _start_service;
+		static std::atomic<uint32_t> _fork_generation;
+	};
+}
@@ -18,9 +18,11 @@
 #include "./converter.h"
 #include "./data.h"
 #include "./delay_queue.h"
+#include "./timer_wheel.h"
 #include "./dump_utilities.h"
 #include "./enable_shared_from_this.h"
 #include "./error.h"
+#include "./file_region.h"
 #include "./json.h"
 #include "./log.h"
 #include "./memory_utilities.h"
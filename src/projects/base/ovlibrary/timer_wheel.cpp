@@ -0,0 +1,310 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./timer_wheel.h"
+
+#include <pthread.h>
+
+#include "./log.h"
+#include "./ovlibrary_private.h"
+
+namespace ov
+{
+	TimerWheel::TimerWheel(const char *name, int tick_ms)
+		: _name(name),
+		  _start_time(std::chrono::steady_clock::now()),
+		  _tick_ms(std::max(tick_ms, 1))
+	{
+	}
+
+	TimerWheel::~TimerWheel()
+	{
+		Stop();
+	}
+
+	bool TimerWheel::Start()
+	{
+		if (_stop == false)
+		{
+			// Already running
+			return false;
+		}
+
+		_stop = false;
+		_thread = std::thread(&TimerWheel::DispatchThreadProc, this);
+
+		String name;
+
+		if (_name.IsEmpty())
+		{
+			name = "TW";
+		}
+		else
+		{
+			name.Format("TW%s", _name.CStr());
+		}
+
+		// The name of a thread can't exceed 15 characters
+		::pthread_setname_np(_thread.native_handle(), name.Left(15));
+
+		return true;
+	}
+
+	bool TimerWheel::Stop()
+	{
+		if (_stop)
+		{
+			// Already stopped
+			return false;
+		}
+
+		_stop = true;
+
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_timers.clear();
+
+		for (auto &level : _slots)
+		{
+			for (auto &slot : level)
+			{
+				slot.clear();
+			}
+		}
+
+		return true;
+	}
+
+	TimerId TimerWheel::Arm(int64_t after_ms, const TimerWheelFunction &function)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto timer_id = ++_last_timer_id;
+
+		auto &timer = _timers[timer_id];
+		timer.id = timer_id;
+		timer.expire_tick = GetExpireTick(after_ms);
+		timer.function = function;
+
+		Link(timer);
+
+		return timer_id;
+	}
+
+	bool TimerWheel::Rearm(TimerId timer_id, int64_t after_ms)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto item = _timers.find(timer_id);
+		if (item == _timers.end())
+		{
+			return false;
+		}
+
+		auto &timer = item->second;
+
+		Unlink(timer);
+		timer.expire_tick = GetExpireTick(after_ms);
+		Link(timer);
+
+		return true;
+	}
+
+	bool TimerWheel::Cancel(TimerId timer_id)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto item = _timers.find(timer_id);
+		if (item == _timers.end())
+		{
+			return false;
+		}
+
+		Unlink(item->second);
+		_timers.erase(item);
+
+		return true;
+	}
+
+	size_t TimerWheel::GetCount() const
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		return _timers.size();
+	}
+
+	uint64_t TimerWheel::GetExpireTick(int64_t after_ms) const
+	{
+		// Round up, and expire in the next tick at the earliest
+		int64_t ticks = (std::max<int64_t>(after_ms, 0) + _tick_ms - 1) / _tick_ms;
+
+		return _current_tick + std::max<int64_t>(ticks, 1);
+	}
+
+	void TimerWheel::Link(Timer &timer)
+	{
+		uint64_t delta = (timer.expire_tick > _current_tick) ? (timer.expire_tick - _current_tick) : 0;
+
+		// Find the lowest level that can hold the timer
+		int level = 0;
+		while ((level < (OV_TIMER_WHEEL_LEVEL_COUNT - 1)) && (delta >= (1ULL << ((level + 1) * OV_TIMER_WHEEL_LEVEL_BITS))))
+		{
+			level++;
+		}
+
+		// Timers beyond the top level are clamped to the farthest tick
+		constexpr uint64_t max_delta = (1ULL << (OV_TIMER_WHEEL_LEVEL_COUNT * OV_TIMER_WHEEL_LEVEL_BITS)) - 1;
+		if (delta > max_delta)
+		{
+			timer.expire_tick = _current_tick + max_delta;
+		}
+
+		auto index = (timer.expire_tick >> (level * OV_TIMER_WHEEL_LEVEL_BITS)) & OV_TIMER_WHEEL_LEVEL_MASK;
+		auto &slot = _slots[level][index];
+
+		slot.push_back(timer.id);
+		timer.slot = &slot;
+		timer.position = std::prev(slot.end());
+	}
+
+	void TimerWheel::Unlink(Timer &timer)
+	{
+		if (timer.slot != nullptr)
+		{
+			timer.slot->erase(timer.position);
+			timer.slot = nullptr;
+		}
+	}
+
+	void TimerWheel::Cascade(int level)
+	{
+		auto index = (_current_tick >> (level * OV_TIMER_WHEEL_LEVEL_BITS)) & OV_TIMER_WHEEL_LEVEL_MASK;
+
+		std::list<TimerId> timer_ids;
+		timer_ids.swap(_slots[level][index]);
+
+		for (auto timer_id : timer_ids)
+		{
+			auto &timer = _timers[timer_id];
+
+			// The timer expires within the range of the lower levels now
+			timer.slot = nullptr;
+			Link(timer);
+		}
+	}
+
+	void TimerWheel::Advance(std::vector<TimerWheelFunction> &expired_functions)
+	{
+		_current_tick++;
+
+		// When a level wraps around, the next slot of the upper level comes down
+		for (int level = 1; level < OV_TIMER_WHEEL_LEVEL_COUNT; level++)
+		{
+			if ((_current_tick & ((1ULL << (level * OV_TIMER_WHEEL_LEVEL_BITS)) - 1)) != 0)
+			{
+				break;
+			}
+
+			Cascade(level);
+		}
+
+		std::list<TimerId> timer_ids;
+		timer_ids.swap(_slots[0][_current_tick & OV_TIMER_WHEEL_LEVEL_MASK]);
+
+		for (auto timer_id : timer_ids)
+		{
+			auto item = _timers.find(timer_id);
+			if (item == _timers.end())
+			{
+				continue;
+			}
+
+			expired_functions.push_back(std::move(item->second.function));
+			_timers.erase(item);
+		}
+	}
+
+	void TimerWheel::DispatchThreadProc()
+	{
+		std::vector<TimerWheelFunction> expired_functions;
+
+		while (_stop == false)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(_tick_ms));
+
+			auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start_time).count();
+			uint64_t target_tick = elapsed_ms / _tick_ms;
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				// If the thread has been delayed, the missed ticks are processed at once
+				while (_current_tick < target_tick)
+				{
+					Advance(expired_functions);
+				}
+			}
+
+			for (auto &function : expired_functions)
+			{
+				if (_stop)
+				{
+					break;
+				}
+
+				function();
+			}
+
+			expired_functions.clear();
+		}
+	}
+
+	TimerWheelPool::TimerWheelPool(const char *name, size_t wheel_count, int tick_ms)
+	{
+		wheel_count = std::max<size_t>(wheel_count, 1);
+
+		for (size_t index = 0; index < wheel_count; index++)
+		{
+			_wheels.push_back(std::make_unique<TimerWheel>(name, tick_ms));
+		}
+	}
+
+	bool TimerWheelPool::Start()
+	{
+		bool result = true;
+
+		for (auto &wheel : _wheels)
+		{
+			result = wheel->Start() && result;
+		}
+
+		return result;
+	}
+
+	bool TimerWheelPool::Stop()
+	{
+		bool result = true;
+
+		for (auto &wheel : _wheels)
+		{
+			result = wheel->Stop() && result;
+		}
+
+		return result;
+	}
+
+	TimerWheel &TimerWheelPool::GetWheel(uint64_t key)
+	{
+		return *(_wheels[key % _wheels.size()]);
+	}
+}  // namespace ov
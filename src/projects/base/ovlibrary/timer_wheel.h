@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "./string.h"
+
+// Each level has 2^8 slots. With 10 ms ticks, level 0 covers 2.56 seconds, level 1 about 11 minutes,
+// level 2 about 46 hours and level 3 about 497 days
+#define OV_TIMER_WHEEL_LEVEL_BITS 8
+#define OV_TIMER_WHEEL_LEVEL_SIZE (1 << OV_TIMER_WHEEL_LEVEL_BITS)
+#define OV_TIMER_WHEEL_LEVEL_MASK (OV_TIMER_WHEEL_LEVEL_SIZE - 1)
+#define OV_TIMER_WHEEL_LEVEL_COUNT 4
+#define OV_TIMER_WHEEL_DEFAULT_TICK_MS 10
+
+namespace ov
+{
+	// 0 is not used as a timer id
+	typedef uint64_t TimerId;
+	typedef std::function<void()> TimerWheelFunction;
+
+	// Hierarchical timing wheel (Varghese & Lauck).
+	//
+	// Arm(), Rearm() and Cancel() are O(1), and the thread of the wheel visits only the slot of the current tick.
+	// A timer far in the future is put in an upper level, and moved down to a lower level when its slot comes.
+	// So a large number of long timers (e.g. idle timeout of each connection) does not cost anything until they expire,
+	// unlike scanning all the connections periodically.
+	//
+	// The callbacks are called from the thread of the wheel without the lock, so a callback can arm a timer again.
+	// The resolution is the tick.
+	class TimerWheel
+	{
+	public:
+		TimerWheel(const char *name, int tick_ms = OV_TIMER_WHEEL_DEFAULT_TICK_MS);
+		virtual ~TimerWheel();
+
+		bool Start();
+		// The callbacks are not called after Stop() returns
+		bool Stop();
+
+		// Returns the id to cancel/re-arm the timer
+		TimerId Arm(int64_t after_ms, const TimerWheelFunction &function);
+		// Changes the expiration of an armed timer. Returns false if the timer has already fired or been cancelled
+		bool Rearm(TimerId timer_id, int64_t after_ms);
+		// Returns false if the timer has already fired or been cancelled
+		bool Cancel(TimerId timer_id);
+
+		size_t GetCount() const;
+
+	protected:
+		struct Timer
+		{
+			TimerId id = 0;
+			uint64_t expire_tick = 0;
+			TimerWheelFunction function;
+
+			// The slot where the timer is linked now
+			std::list<TimerId> *slot = nullptr;
+			std::list<TimerId>::iterator position;
+		};
+
+		// Must be called with _mutex
+		void Link(Timer &timer);
+		void Unlink(Timer &timer);
+		uint64_t GetExpireTick(int64_t after_ms) const;
+
+		// Advances a tick, and collects the functions of the expired timers (must be called with _mutex)
+		void Advance(std::vector<TimerWheelFunction> &expired_functions);
+		// Moves the timers of the slot of the upper level to the lower levels
+		void Cascade(int level);
+
+		void DispatchThreadProc();
+
+		ov::String _name;
+		std::chrono::steady_clock::time_point _start_time;
+		const int _tick_ms;
+
+		std::thread _thread;
+		std::atomic<bool> _stop{true};
+
+		mutable std::mutex _mutex;
+		uint64_t _current_tick = 0;
+		TimerId _last_timer_id = 0;
+		std::unordered_map<TimerId, Timer> _timers;
+		std::array<std::array<std::list<TimerId>, OV_TIMER_WHEEL_LEVEL_SIZE>, OV_TIMER_WHEEL_LEVEL_COUNT> _slots;
+	};
+
+	// Multiple wheels that run on their own threads.
+	// A timer is armed to the wheel selected by a key (e.g. session id), so the owner of the key always uses
+	// the same wheel and the threads arming the timers of different keys don't contend on a single lock.
+	class TimerWheelPool
+	{
+	public:
+		TimerWheelPool(const char *name, size_t wheel_count, int tick_ms = OV_TIMER_WHEEL_DEFAULT_TICK_MS);
+
+		bool Start();
+		bool Stop();
+
+		TimerWheel &GetWheel(uint64_t key);
+
+	private:
+		std::vector<std::unique_ptr<TimerWheel>> _wheels;
+	};
+}  // namespace ov
@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "datagram_receive_ring.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "socket_datastructure.h"
+
+namespace ov
+{
+	DatagramReceiveRing::DatagramReceiveRing()
+	{
+		::memset(_mmsghdrs.data(), 0, sizeof(mmsghdr) * _mmsghdrs.size());
+	}
+
+	mmsghdr *DatagramReceiveRing::Prepare()
+	{
+		for (int index = 0; index < _used_count; index++)
+		{
+			auto &buffer = _buffers[index];
+
+			// If someone keeps the buffer, allocate a new one
+			if ((buffer == nullptr) || (buffer.use_count() > 1))
+			{
+				buffer = std::make_shared<Data>(UdpBufferSize);
+			}
+
+			// If the memory is shared with a clone of the buffer, SetLength() detaches it
+			buffer->SetLength(UdpBufferSize);
+
+			auto &iov = _iovecs[index];
+			iov.iov_base = buffer->GetWritableData();
+			iov.iov_len = buffer->GetLength();
+
+			auto &control = _controls[index];
+			auto &header = _mmsghdrs[index].msg_hdr;
+
+			header.msg_name = &(_remotes[index]);
+			header.msg_namelen = sizeof(sockaddr_storage);
+			header.msg_iov = &iov;
+			header.msg_iovlen = 1;
+			header.msg_control = control.data();
+			header.msg_controllen = control.size();
+			header.msg_flags = 0;
+
+			_mmsghdrs[index].msg_len = 0;
+		}
+
+		_used_count = 0;
+
+		return _mmsghdrs.data();
+	}
+
+	void DatagramReceiveRing::SetReceivedCount(int count)
+	{
+		for (int index = 0; index < count; index++)
+		{
+			_buffers[index]->SetLength(_mmsghdrs[index].msg_len);
+		}
+
+		_used_count = count;
+	}
+}  // namespace ov
@@ -0,0 +1,81 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <array>
+#include <memory>
+
+#include "socket_address_pair.h"
+
+namespace ov
+{
+	class Data;
+
+	// The maximum number of datagrams received with one recvmmsg()
+	constexpr const int UdpRecvBatchMaxCount = 32;
+
+	// A ring of preallocated receive buffers used with recvmmsg().
+	// It is owned by SocketPoolWorker and used only in its thread, so it doesn't need any lock.
+	//
+	// The buffer passed to the DatagramCallback is reused in the next recvmmsg() if nobody keeps it.
+	// If the callback keeps the buffer (std::shared_ptr<Data>), a new buffer is allocated for the slot.
+	class DatagramReceiveRing
+	{
+	public:
+		DatagramReceiveRing();
+
+		// Prepares the slots consumed by the previous recvmmsg() and returns mmsghdr list to pass to recvmmsg()
+		mmsghdr *Prepare();
+
+		// Sets the length of the received data to each slot
+		void SetReceivedCount(int count);
+
+		int GetCapacity() const
+		{
+			return UdpRecvBatchMaxCount;
+		}
+
+		const std::shared_ptr<Data> &GetData(int index) const
+		{
+			return _buffers[index];
+		}
+
+		msghdr *GetMessageHeader(int index)
+		{
+			return &(_mmsghdrs[index].msg_hdr);
+		}
+
+		const sockaddr_storage &GetRemote(int index) const
+		{
+			return _remotes[index];
+		}
+
+		SocketAddressPair &GetAddressPair(int index)
+		{
+			return _address_pairs[index];
+		}
+
+	protected:
+		// The size of control buffer that can contain in6_pktinfo
+		static constexpr size_t ControlBufferSize = CMSG_SPACE(sizeof(in6_pktinfo));
+
+		// The number of slots that need to be prepared before the next recvmmsg()
+		int _used_count = UdpRecvBatchMaxCount;
+
+		std::array<std::shared_ptr<Data>, UdpRecvBatchMaxCount> _buffers;
+		std::array<iovec, UdpRecvBatchMaxCount> _iovecs;
+		std::array<mmsghdr, UdpRecvBatchMaxCount> _mmsghdrs;
+		std::array<sockaddr_storage, UdpRecvBatchMaxCount> _remotes;
+		std::array<std::array<uint8_t, ControlBufferSize>, UdpRecvBatchMaxCount> _controls;
+		std::array<SocketAddressPair, UdpRecvBatchMaxCount> _address_pairs;
+	};
+}  // namespace ov
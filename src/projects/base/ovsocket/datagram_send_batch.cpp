@@ -0,0 +1,229 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "datagram_send_batch.h"
+
+#include <netinet/udp.h>
+
+#include <algorithm>
+
+#include "socket.h"
+
+#ifndef SOL_UDP
+#	define SOL_UDP 17
+#endif	// SOL_UDP
+
+#ifndef UDP_SEGMENT
+#	define UDP_SEGMENT 103
+#endif	// UDP_SEGMENT
+
+namespace ov
+{
+	// The innermost DatagramSendBatch of the current thread
+	static thread_local DatagramSendBatch *_current_batch = nullptr;
+
+	DatagramBatchStatistics DatagramSendBatch::_statistics;
+
+	DatagramSendBatch::DatagramSendBatch()
+		: _previous_batch(_current_batch)
+	{
+		_current_batch = this;
+	}
+
+	DatagramSendBatch::~DatagramSendBatch()
+	{
+		Flush();
+
+		_current_batch = _previous_batch;
+	}
+
+	void DatagramSendBatch::Flush()
+	{
+		if (_sockets.empty())
+		{
+			return;
+		}
+
+		_statistics.flush_count++;
+
+		for (auto &socket : _sockets)
+		{
+			socket->DispatchEventsOrDispatchLater();
+		}
+
+		_sockets.clear();
+	}
+
+	bool DatagramSendBatch::AddSocket(const std::shared_ptr<Socket> &socket)
+	{
+		auto batch = _current_batch;
+
+		if (batch == nullptr)
+		{
+			return false;
+		}
+
+		// Usually, only one or two sockets (ICE ports) are used in a batch, so linear search is enough
+		if (std::find(batch->_sockets.begin(), batch->_sockets.end(), socket) == batch->_sockets.end())
+		{
+			batch->_sockets.push_back(socket);
+		}
+
+		return true;
+	}
+
+	void DatagramMessageBuilder::Reset(bool use_gso)
+	{
+		_use_gso = use_gso;
+		_has_gso_message = false;
+
+		_datagram_count = 0;
+		_message_count = 0;
+	}
+
+	bool DatagramMessageBuilder::Add(const SocketAddress *local_address, const SocketAddress &remote_address, const void *data, size_t length)
+	{
+		if (_datagram_count >= UdpBatchMaxCount)
+		{
+			return false;
+		}
+
+		auto &iov = _iovecs[_datagram_count];
+		// This is intentional conversion
+		iov.iov_base = const_cast<void *>(data);
+		iov.iov_len = length;
+
+		if ((_use_gso) && (_message_count > 0))
+		{
+			auto &last_message = _messages[_message_count - 1];
+
+			// All segments except the last one must have the same size, and the last one can be smaller
+			if ((last_message.last_segment_size == last_message.segment_size) &&
+				(length <= last_message.segment_size) &&
+				(last_message.segment_count < UdpGsoMaxSegments) &&
+				((last_message.total_bytes + length) <= UdpGsoMaxBytes) &&
+				(last_message.remote_address == &remote_address || *(last_message.remote_address) == remote_address) &&
+				(((last_message.local_address == nullptr) && (local_address == nullptr)) ||
+				 ((last_message.local_address != nullptr) && (local_address != nullptr) && (*(last_message.local_address) == *local_address))))
+			{
+				last_message.segment_count++;
+				last_message.last_segment_size = length;
+				last_message.total_bytes += length;
+
+				_datagram_count++;
+				return true;
+			}
+		}
+
+		auto &message = _messages[_message_count];
+
+		message.local_address = local_address;
+		message.remote_address = &remote_address;
+		message.first_datagram_index = _datagram_count;
+		message.segment_count = 1;
+		message.segment_size = length;
+		message.last_segment_size = length;
+		message.total_bytes = length;
+
+		_message_count++;
+		_datagram_count++;
+
+		return true;
+	}
+
+	template <typename Tpktinfo>
+	static cmsghdr *AppendPktInfo(cmsghdr *cmsg, int msg_level, int msg_type, const Tpktinfo &pktinfo)
+	{
+		cmsg->cmsg_level = msg_level;
+		cmsg->cmsg_type = msg_type;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(pktinfo));
+		::memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+		return reinterpret_cast<cmsghdr *>(reinterpret_cast<uint8_t *>(cmsg) + CMSG_SPACE(sizeof(pktinfo)));
+	}
+
+	ssize_t DatagramMessageBuilder::Send(int socket_handle)
+	{
+		for (int index = 0; index < _message_count; index++)
+		{
+			auto &message = _messages[index];
+			auto &control = _controls[index];
+			auto &header = _mmsghdrs[index].msg_hdr;
+
+			_mmsghdrs[index].msg_len = 0;
+
+			// This is intentional conversion
+			header.msg_name = const_cast<sockaddr *>(message.remote_address->ToSockAddr());
+			header.msg_namelen = message.remote_address->GetSockAddrInLength();
+			header.msg_iov = &(_iovecs[message.first_datagram_index]);
+			header.msg_iovlen = message.segment_count;
+			header.msg_flags = 0;
+
+			auto cmsg = reinterpret_cast<cmsghdr *>(control.data());
+			size_t control_length = 0;
+
+			if (message.local_address != nullptr)
+			{
+				if (message.local_address->IsIPv4())
+				{
+					in_pktinfo pktinfo{};
+					pktinfo.ipi_spec_dst.s_addr = message.local_address->ToIn4Addr()->s_addr;
+					cmsg = AppendPktInfo(cmsg, IPPROTO_IP, IP_PKTINFO, pktinfo);
+					control_length += CMSG_SPACE(sizeof(pktinfo));
+				}
+				else
+				{
+					in6_pktinfo pktinfo{};
+					::memcpy(&pktinfo.ipi6_addr, message.local_address->ToIn6Addr(), sizeof(in6_addr));
+					cmsg = AppendPktInfo(cmsg, IPPROTO_IPV6, IPV6_PKTINFO, pktinfo);
+					control_length += CMSG_SPACE(sizeof(pktinfo));
+				}
+			}
+
+			if (message.segment_count > 1)
+			{
+				uint16_t segment_size = static_cast<uint16_t>(message.segment_size);
+				AppendPktInfo(cmsg, SOL_UDP, UDP_SEGMENT, segment_size);
+				control_length += CMSG_SPACE(sizeof(segment_size));
+
+				_has_gso_message = true;
+			}
+
+			header.msg_control = (control_length > 0) ? control.data() : nullptr;
+			header.msg_controllen = control_length;
+		}
+
+		auto &statistics = DatagramSendBatch::_statistics;
+
+		const int sent_messages = ::sendmmsg(socket_handle, _mmsghdrs.data(), _message_count, MSG_NOSIGNAL | MSG_DONTWAIT);
+		statistics.syscall_count++;
+
+		if (sent_messages < 0)
+		{
+			return -1L;
+		}
+
+		ssize_t sent_datagrams = 0L;
+
+		for (int index = 0; index < sent_messages; index++)
+		{
+			auto segment_count = _messages[index].segment_count;
+
+			if (segment_count > 1)
+			{
+				statistics.gso_packet_count += segment_count;
+			}
+
+			sent_datagrams += segment_count;
+		}
+
+		statistics.packet_count += sent_datagrams;
+
+		return sent_datagrams;
+	}
+}  // namespace ov
@@ -0,0 +1,137 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "socket_address.h"
+
+namespace ov
+{
+	class Socket;
+
+	// The maximum number of datagrams sent with one sendmmsg()
+	constexpr const int UdpBatchMaxCount = 64;
+	// The maximum number of segments in one UDP_SEGMENT (GSO) message (UDP_MAX_SEGMENTS of the kernel)
+	constexpr const int UdpGsoMaxSegments = 64;
+	constexpr const size_t UdpGsoMaxBytes = 65507;
+
+	struct DatagramBatchStatistics
+	{
+		// The number of DatagramSendBatch::Flush() that had datagrams to send
+		std::atomic<uint64_t> flush_count{0};
+		// The number of sendmmsg() calls
+		std::atomic<uint64_t> syscall_count{0};
+		// The number of datagrams sent by sendmmsg()
+		std::atomic<uint64_t> packet_count{0};
+		// The number of datagrams sent as a segment of UDP_SEGMENT (GSO) message
+		std::atomic<uint64_t> gso_packet_count{0};
+	};
+
+	// While an instance is alive on the current thread, the datagrams sent via non-blocking UDP sockets
+	// with batched egress enabled (DatagramSocket::SetBatchedEgress()) are queued to the socket instead of being sent immediately,
+	// and they are sent together by sendmmsg() when the instance is destroyed (or Flush() is called).
+	//
+	// Usage:
+	//   {
+	//       ov::DatagramSendBatch batch;
+	//
+	//       for (auto &session : sessions)
+	//       {
+	//           session->SendOutgoingData(packet);
+	//       }
+	//   } // <-- All datagrams are sent here
+	class DatagramSendBatch
+	{
+	public:
+		DatagramSendBatch();
+		~DatagramSendBatch();
+
+		// Disable copy & move operator
+		DatagramSendBatch(const DatagramSendBatch &batch) = delete;
+		DatagramSendBatch(DatagramSendBatch &&batch) = delete;
+
+		void Flush();
+
+		// Returns false if there is no DatagramSendBatch on the current thread
+		static bool AddSocket(const std::shared_ptr<Socket> &socket);
+
+		static const DatagramBatchStatistics &GetStatistics()
+		{
+			return _statistics;
+		}
+
+	protected:
+		friend class DatagramMessageBuilder;
+
+		static DatagramBatchStatistics _statistics;
+
+		DatagramSendBatch *_previous_batch = nullptr;
+		std::vector<std::shared_ptr<Socket>> _sockets;
+	};
+
+	// Builds the mmsghdr list for sendmmsg().
+	// Consecutive datagrams to the same peer are merged into one UDP_SEGMENT message if possible.
+	class DatagramMessageBuilder
+	{
+	public:
+		void Reset(bool use_gso);
+
+		// local_address can be nullptr (sendto() semantics)
+		// Returns false if no more datagrams can be added
+		bool Add(const SocketAddress *local_address, const SocketAddress &remote_address, const void *data, size_t length);
+
+		// Returns the number of datagrams sent, or -1 if an error occurred (errno is set)
+		ssize_t Send(int socket_handle);
+
+		int GetDatagramCount() const
+		{
+			return _datagram_count;
+		}
+
+		bool HasGsoMessage() const
+		{
+			return _has_gso_message;
+		}
+
+	protected:
+		struct Message
+		{
+			const SocketAddress *local_address;
+			const SocketAddress *remote_address;
+
+			// Index of the first datagram in _iovecs
+			int first_datagram_index;
+			int segment_count;
+			size_t segment_size;
+			size_t last_segment_size;
+			size_t total_bytes;
+		};
+
+		// The size of control buffer that can contain in6_pktinfo and UDP_SEGMENT
+		static constexpr size_t ControlBufferSize = CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(uint16_t));
+
+		bool _use_gso = false;
+		bool _has_gso_message = false;
+
+		int _datagram_count = 0;
+		int _message_count = 0;
+
+		std::array<Message, UdpBatchMaxCount> _messages;
+		std::array<iovec, UdpBatchMaxCount> _iovecs;
+		std::array<mmsghdr, UdpBatchMaxCount> _mmsghdrs;
+		std::array<std::array<uint8_t, ControlBufferSize>, UdpBatchMaxCount> _controls;
+	};
+}  // namespace ov
@@ -10,6 +10,7 @@
 #include "datagram_socket.h"
 
 #include "client_socket.h"
+#include "socket_pool/socket_pool_worker.h"
 #include "socket_private.h"
 
 #undef OV_LOG_TAG
@@ -50,6 +51,18 @@ namespace ov
 		return false;
 	}
 
+	void DatagramSocket::SetBatchedEgress(bool enabled)
+	{
+		std::lock_guard lock_guard(_dispatch_queue_lock);
+
+		if (enabled && (_datagram_builder == nullptr))
+		{
+			_datagram_builder = std::make_unique<DatagramMessageBuilder>();
+		}
+
+		_batched_egress = enabled;
+	}
+
 	bool DatagramSocket::CloseInternal(SocketState close_reason)
 	{
 		_callback = nullptr;
@@ -67,6 +80,18 @@ namespace ov
 	{
 		logtp("Trying to read UDP packets...");
 
+		if (_batched_ingress)
+		{
+			ReadDatagramsUsingRing();
+		}
+		else
+		{
+			ReadDatagrams();
+		}
+	}
+
+	void DatagramSocket::ReadDatagrams()
+	{
 		auto data = std::make_shared<ov::Data>(UdpBufferSize);
 
 		SocketAddressPair address_pair;
@@ -99,6 +124,48 @@ namespace ov
 		}
 	}
 
+	void DatagramSocket::ReadDatagramsUsingRing()
+	{
+		auto ring = _worker->GetDatagramReceiveRing();
+
+		while (true)
+		{
+			int received_count;
+
+			auto error = RecvFromMultiple(ring, &received_count);
+
+			if ((error != nullptr) || (received_count == 0))
+			{
+				// An error occurred, or try later
+				break;
+			}
+
+			if (_datagram_callback != nullptr)
+			{
+				auto instance = GetSharedPtrAs<DatagramSocket>();
+
+				for (int index = 0; index < received_count; index++)
+				{
+					auto &data = ring->GetData(index);
+
+					if (data->GetLength() == 0)
+					{
+						// A zero-length datagram is not passed to the handlers, as in ReadDatagrams()
+						continue;
+					}
+
+					_datagram_callback(instance, ring->GetAddressPair(index), data);
+				}
+			}
+
+			if (received_count < ring->GetCapacity())
+			{
+				// The socket buffer is drained (recvmmsg() with MSG_DONTWAIT returns less than requested only in this case)
+				break;
+			}
+		}
+	}
+
 	String DatagramSocket::ToString() const
 	{
 		return Socket::ToString("DatagramSocket");
@@ -36,6 +36,15 @@ namespace ov
 		using Socket::Send;
 		using Socket::SendTo;
 
+		// If enabled, the datagrams sent while ov::DatagramSendBatch is alive on the current thread are sent together using sendmmsg()
+		void SetBatchedEgress(bool enabled);
+
+		// If enabled (default), the datagrams are received using recvmmsg() into the receive buffers of the socket pool worker
+		void SetBatchedIngress(bool enabled)
+		{
+			_batched_ingress = enabled;
+		}
+
 		String ToString() const override;
 
 	protected:
@@ -53,6 +62,8 @@ namespace ov
 			OV_ASSERT2(false);
 		}
 		void OnReadable() override;
+		void ReadDatagrams();
+		void ReadDatagramsUsingRing();
 		void OnClosed() override
 		{
 			// datagram socket should not be called this event
@@ -60,5 +71,7 @@ namespace ov
 		}
 
 		DatagramCallback _datagram_callback = nullptr;
+
+		bool _batched_ingress = true;
 	};
 }  // namespace ov
@@ -18,6 +18,8 @@
 #include "server_socket.h"
 
 // UDP socket
+#include "datagram_receive_ring.h"
+#include "datagram_send_batch.h"
 #include "datagram_socket.h"
 
 // Socket pool
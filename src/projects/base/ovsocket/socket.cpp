@@ -14,6 +14,10 @@
 #include <sys/ioctl.h>
 #include <unistd.h>
 
+#if !IS_MACOS
+#	include <sys/sendfile.h>
+#endif	// !IS_MACOS
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -256,23 +260,28 @@ namespace ov
 
 		if (dispatch_immediately)
 		{
-			switch (DispatchEvents())
-			{
-				case DispatchResult::Dispatched:
-					return true;
-
-				case DispatchResult::PartialDispatched:
-					_worker->EnqueueToDispatchLater(GetSharedPtr());
-					return true;
-
-				case DispatchResult::Error:
-					break;
-			}
+			DispatchEventsOrDispatchLater();
 		}
 
 		return true;
 	}
 
+	void Socket::DispatchEventsOrDispatchLater()
+	{
+		switch (DispatchEvents())
+		{
+			case DispatchResult::Dispatched:
+				break;
+
+			case DispatchResult::PartialDispatched:
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+				break;
+
+			case DispatchResult::Error:
+				break;
+		}
+	}
+
 	bool Socket::AddToWorker(bool need_to_wait_first_epoll_event)
 	{
 		if (GetType() == SocketType::Srt)
@@ -857,6 +866,31 @@ namespace ov
 				sent_bytes = SendFromToInternal(command.address_pair, data);
 				break;
 
+			case DispatchCommand::Type::SendFile: {
+				auto &file = command.file;
+				sent_bytes = SendFileInternal(file, command.file_offset);
+
+				if (sent_bytes == -1)
+				{
+					return DispatchResult::Error;
+				}
+
+				command.file_offset += sent_bytes;
+
+				if (command.file_offset == file->GetLength())
+				{
+					return DispatchResult::Dispatched;
+				}
+
+				if (sent_bytes > 0)
+				{
+					command.UpdateTime();
+					logad("Part of the file has been sent: %ld bytes, left: %zu bytes (%s)", sent_bytes, file->GetLength() - command.file_offset, command.ToString().CStr());
+				}
+
+				return DispatchResult::PartialDispatched;
+			}
+
 			case DispatchCommand::Type::HalfClose:
 				return HalfClose();
 
@@ -908,11 +942,78 @@ namespace ov
 		return DispatchResult::PartialDispatched;
 	}
 
+	Socket::DispatchResult Socket::DispatchDatagramsInternal()
+	{
+		// _dispatch_queue_lock must be held by the caller
+		auto &builder = *_datagram_builder;
+
+		while (true)
+		{
+			builder.Reset(_gso_enabled);
+
+			for (auto &command : _dispatch_queue)
+			{
+				if (command.IsDatagramCommand() == false)
+				{
+					break;
+				}
+
+				bool added = (command.type == DispatchCommand::Type::SendTo)
+								 ? builder.Add(nullptr, command.address, command.data->GetData(), command.data->GetLength())
+								 : builder.Add(&(command.address_pair.GetLocalAddress()), command.address_pair.GetRemoteAddress(), command.data->GetData(), command.data->GetLength());
+
+				if (added == false)
+				{
+					break;
+				}
+			}
+
+			const auto sent_count = builder.Send(GetNativeHandle());
+
+			if (sent_count >= 0L)
+			{
+				if (sent_count > 0L)
+				{
+					STATS_COUNTER_INCREASE_PPS();
+					UpdateLastSentTime();
+				}
+
+				for (ssize_t index = 0L; index < sent_count; index++)
+				{
+					_dispatch_queue.pop_front();
+				}
+
+				return (sent_count == builder.GetDatagramCount()) ? DispatchResult::Dispatched : DispatchResult::PartialDispatched;
+			}
+
+			const auto error = errno;
+
+			if (builder.HasGsoMessage() && ((error == EIO) || (error == EINVAL)))
+			{
+				// UDP_SEGMENT is not supported by the kernel or the NIC (checksum offload is disabled) - retry without GSO
+				logaw("Could not send datagrams using UDP_SEGMENT (%s), GSO will be disabled for this socket", ::strerror(error));
+				_gso_enabled = false;
+				continue;
+			}
+
+			if (HandleSendError(-1L, 0L) == 0L)
+			{
+				// EAGAIN
+				return DispatchResult::PartialDispatched;
+			}
+
+			// Drop the datagram that caused the error like DispatchEventsInternal() does
+			_dispatch_queue.pop_front();
+			return DispatchResult::Error;
+		}
+	}
+
 	Socket::DispatchResult Socket::DispatchEventsInternal()
 	{
 		SOCKET_PROFILER_INIT();
 
 		DispatchResult result = DispatchResult::Dispatched;
+		std::shared_ptr<const std::function<void()>> dispatch_completed_callback;
 
 		{
 			SOCKET_PROFILER_AFTER_LOCK();
@@ -934,6 +1035,22 @@ namespace ov
 
 				while (_dispatch_queue.empty() == false)
 				{
+					if ((_datagram_builder != nullptr) &&
+						(_dispatch_queue.size() > 1) &&
+						_dispatch_queue.front().IsDatagramCommand() &&
+						(GetState() != SocketState::Closed))
+					{
+						result = DispatchDatagramsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							// Dispatches the next item
+							continue;
+						}
+
+						break;
+					}
+
 					auto front = _dispatch_queue.front();
 					_dispatch_queue.pop_front();
 
@@ -985,6 +1102,16 @@ namespace ov
 					break;
 				}
 			}
+
+			if ((result == DispatchResult::Dispatched) && _dispatch_queue.empty())
+			{
+				dispatch_completed_callback = _dispatch_completed_callback;
+			}
+		}
+
+		if (dispatch_completed_callback != nullptr)
+		{
+			(*dispatch_completed_callback)();
 		}
 
 		return result;
@@ -1241,6 +1368,88 @@ namespace ov
 		return Send((data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+	ssize_t Socket::SendFileInternal(const std::shared_ptr<const FileRegion> &file, size_t offset)
+	{
+#if IS_MACOS
+		logac("Could not send file - sendfile() is not supported");
+		OV_ASSERT2(false);
+		return -1L;
+#else	// IS_MACOS
+		if (GetType() != SocketType::Tcp)
+		{
+			// sendfile() is available for the stream socket only
+			logac("Could not send file - Invalid socket type: %s", StringFromSocketType(GetType()));
+			OV_ASSERT2(false);
+			return -1L;
+		}
+
+		size_t remaining_bytes = file->GetLength() - offset;
+		size_t total_sent_bytes = 0L;
+
+		logap("Trying to send file %zu bytes...", remaining_bytes);
+
+		while ((remaining_bytes > 0L) && (_force_stop == false))
+		{
+			off_t file_offset = file->GetOffset() + offset + total_sent_bytes;
+			const auto sent = ::sendfile(GetNativeHandle(), file->GetNativeHandle(), &file_offset, remaining_bytes);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			if (sent == 0L)
+			{
+				// The file is truncated after opened
+				logaw("Could not send file - unexpected end of file (%zu bytes left)", remaining_bytes);
+				STATS_COUNTER_INCREASE_ERROR();
+				return -1L;
+			}
+
+			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			remaining_bytes -= sent;
+			total_sent_bytes += sent;
+
+			UpdateLastSentTime();
+		}
+
+		logap("%zu bytes of file sent", total_sent_bytes);
+		return total_sent_bytes;
+#endif	// IS_MACOS
+	}
+
+	bool Socket::SendFile(const std::shared_ptr<const FileRegion> &file)
+	{
+		if (file == nullptr)
+		{
+			OV_ASSERT2(file != nullptr);
+			return false;
+		}
+
+		if (file->GetLength() == 0)
+		{
+			return true;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				return (SendFileInternal(file, 0) == static_cast<ssize_t>(file->GetLength()));
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					return AppendCommand({file}, true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
 	ssize_t Socket::SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 	{
 		if (GetType() != SocketType::Udp)
@@ -1301,7 +1510,7 @@ namespace ov
 						(GetType() == SocketType::Udp)
 							? DispatchCommand(address, data->Clone())
 							: DispatchCommand(data->Clone()),
-						true);
+						(_batched_egress && DatagramSendBatch::AddSocket(GetSharedPtr())) == false);
 				}
 				break;
 		}
@@ -1474,7 +1683,7 @@ namespace ov
 						(GetType() == SocketType::Udp)
 							? DispatchCommand(address_pair, data->Clone())
 							: DispatchCommand(data->Clone()),
-						true);
+						(_batched_egress && DatagramSendBatch::AddSocket(GetSharedPtr())) == false);
 				}
 		}
 
@@ -1725,6 +1934,74 @@ namespace ov
 		return SocketAddress();
 	}
 
+	std::shared_ptr<const SocketError> Socket::RecvFromMultiple(DatagramReceiveRing *ring, int *received_count)
+	{
+		OV_ASSERT2(_socket.IsValid());
+		OV_ASSERT2(ring != nullptr);
+		OV_ASSERT2(received_count != nullptr);
+
+		*received_count = 0;
+
+		if (GetType() != SocketType::Udp)
+		{
+			OV_ASSERT2(false);
+			return SocketError::CreateError("RecvFromMultiple() is supported only for UDP");
+		}
+
+		logad("Trying to read multiple datagrams from the socket...");
+
+		auto mmsghdrs = ring->Prepare();
+
+		const int count = ::recvmmsg(GetNativeHandle(), mmsghdrs, ring->GetCapacity(), MSG_DONTWAIT, nullptr);
+
+		if (count < 0)
+		{
+			ring->SetReceivedCount(0);
+
+			auto error = Error::CreateErrorFromErrno();
+
+			if (error->GetCode() == EAGAIN)
+			{
+				// Timed out
+				return nullptr;
+			}
+
+			auto socket_error = SocketError::CreateError(error);
+
+			logae("An error occurred while read data: %s\nStack trace: %s",
+				  socket_error->What(),
+				  StackTrace::GetStackTrace().CStr());
+
+			CloseWithState(SocketState::Error);
+
+			return socket_error;
+		}
+
+		ring->SetReceivedCount(count);
+
+		const auto port = GetLocalAddress()->Port();
+
+		for (int index = 0; index < count; index++)
+		{
+			auto &address_pair = ring->GetAddressPair(index);
+			const auto &remote = ring->GetRemote(index);
+
+			address_pair.SetLocalAddress(QueryLocalAddress(_family, port, remote, ring->GetMessageHeader(index)));
+			address_pair.SetRemoteAddress(SocketAddress("", remote));
+		}
+
+		logad("%d datagrams read", count);
+
+		if (count > 0)
+		{
+			UpdateLastRecvTime();
+		}
+
+		*received_count = count;
+
+		return nullptr;
+	}
+
 	std::shared_ptr<const SocketError> Socket::RecvFrom(std::shared_ptr<Data> &data, SocketAddressPair *address_pair, const bool non_block)
 	{
 		OV_ASSERT2(_socket.IsValid());
@@ -11,6 +11,8 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 
+#include "datagram_receive_ring.h"
+#include "datagram_send_batch.h"
 #include "socket_address.h"
 #include "socket_address_pair.h"
 #include "socket_wrapper.h"
@@ -55,6 +57,7 @@ namespace ov
 	{
 	protected:
 		friend class SocketPoolWorker;
+		friend class DatagramSendBatch;
 
 		OV_SOCKET_DECLARE_PRIVATE_TOKEN();
 
@@ -181,6 +184,9 @@ namespace ov
 		bool SendFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
 		bool SendFromTo(const SocketAddressPair &address_pair, const void *data, size_t length);
 
+		// Sends the whole file region using sendfile(), without copying the file to the user space (TCP only)
+		bool SendFile(const std::shared_ptr<const FileRegion> &file);
+
 		// When Recv is called in non-blocking mode,
 		//
 		// 1. return != nullptr: An error occurred (Include disconnecting the client)
@@ -196,6 +202,10 @@ namespace ov
 		// If MakeNonBlocking() is called, non_block is ignored
 		std::shared_ptr<const SocketError> RecvFrom(std::shared_ptr<Data> &data, SocketAddressPair *address_pair, const bool non_block = false);
 
+		// Receives up to ring->GetCapacity() datagrams at once using recvmmsg() (UDP & non-blocking only)
+		// received_count == 0 means EAGAIN (Retry later)
+		std::shared_ptr<const SocketError> RecvFromMultiple(DatagramReceiveRing *ring, int *received_count);
+
 		std::chrono::system_clock::time_point GetLastRecvTime() const;
 		std::chrono::system_clock::time_point GetLastSentTime() const;
 
@@ -216,6 +226,21 @@ namespace ov
 			return _dispatch_queue.size() > 0;
 		}
 
+		// The number of commands waiting to be sent (non-blocking mode only)
+		size_t GetDispatchQueueSize() const
+		{
+			std::lock_guard lock_guard(_dispatch_queue_lock);
+			return _dispatch_queue.size();
+		}
+
+		// Called every time the dispatch queue becomes empty (non-blocking mode only), including inside Send().
+		// A sender can use it to feed the socket only as fast as the data is sent (e.g. HTTP/2 frame scheduling).
+		void SetDispatchCompletedCallback(const std::function<void()> &callback)
+		{
+			std::lock_guard lock_guard(_dispatch_queue_lock);
+			_dispatch_completed_callback = (callback != nullptr) ? std::make_shared<const std::function<void()>>(callback) : nullptr;
+		}
+
 		bool HasExpiredCommand() const
 		{
 			std::lock_guard lock_guard(_dispatch_queue_lock);
@@ -262,6 +287,8 @@ namespace ov
 				SendTo = 0x02,
 				// Need to send data using sendmsg()
 				SendFromTo = 0x03,
+				// Need to send a file using sendfile() (TCP only)
+				SendFile = 0x04,
 
 				// Need to call shutdown(SHUT_WR) (TCP only)
 				HalfClose = CLOSE_TYPE_MASK | 0x01,
@@ -287,6 +314,9 @@ namespace ov
 					case Type::SendFromTo:
 						return "SendFromTo";
 
+					case Type::SendFile:
+						return "SendFile";
+
 					case Type::HalfClose:
 						return "HalfClose";
 
@@ -323,6 +353,13 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const std::shared_ptr<const FileRegion> &file)
+				: type(Type::SendFile),
+				  file(file),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(Type type)
 				: type(type),
 				  enqueued_time(std::chrono::system_clock::now())
@@ -343,6 +380,8 @@ namespace ov
 				  address(another_command.address),
 				  address_pair(another_command.address_pair),
 				  data(another_command.data),
+				  file(another_command.file),
+				  file_offset(another_command.file_offset),
 				  enqueued_time(another_command.enqueued_time)
 			{
 			}
@@ -355,6 +394,8 @@ namespace ov
 				std::swap(address, another_command.address);
 				std::swap(address_pair, another_command.address_pair);
 				std::swap(data, another_command.data);
+				std::swap(file, another_command.file);
+				std::swap(file_offset, another_command.file_offset);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
@@ -363,6 +404,11 @@ namespace ov
 				return OV_CHECK_FLAG(static_cast<uint8_t>(type), CLOSE_TYPE_MASK);
 			}
 
+			bool IsDatagramCommand() const
+			{
+				return (type == Type::SendTo) || (type == Type::SendFromTo);
+			}
+
 			void UpdateTime()
 			{
 				enqueued_time = std::chrono::system_clock::now();
@@ -398,6 +444,11 @@ namespace ov
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
 				}
 
+				if (file != nullptr)
+				{
+					description.AppendFormat(", file: %zu/%zu bytes", file_offset, file->GetLength());
+				}
+
 				description.Append('>');
 
 				return description;
@@ -408,6 +459,9 @@ namespace ov
 			SocketAddress address;
 			SocketAddressPair address_pair;
 			std::shared_ptr<const Data> data;
+			// The file to send, and the number of bytes already sent (Type::SendFile)
+			std::shared_ptr<const FileRegion> file;
+			size_t file_offset = 0;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
 
@@ -421,6 +475,9 @@ namespace ov
 
 		bool AppendCommand(DispatchCommand command, bool dispatch_immediately);
 
+		// Dispatches the queued commands, and if some of them are not dispatched, the socket is enqueued to the worker
+		void DispatchEventsOrDispatchLater();
+
 		//--------------------------------------------------------------------
 		// Implementation of SocketPoolEventInterface
 		//--------------------------------------------------------------------
@@ -430,6 +487,8 @@ namespace ov
 		//--------------------------------------------------------------------
 
 		DispatchResult DispatchEventInternal(DispatchCommand &command);
+		// Sends the consecutive SendTo/SendFromTo commands at the front of _dispatch_queue using sendmmsg()
+		DispatchResult DispatchDatagramsInternal();
 
 		bool IsSendable() const;
 		ssize_t HandleSendError(const ssize_t result, const size_t total_sent);
@@ -442,6 +501,8 @@ namespace ov
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
 		ssize_t SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		ssize_t SendFromToInternal(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
+		// Sends the file from <offset>, and returns the number of bytes sent
+		ssize_t SendFileInternal(const std::shared_ptr<const FileRegion> &file, size_t offset);
 
 		std::shared_ptr<SocketError> RecvInternal(void *data, size_t length, size_t *received_length);
 
@@ -524,6 +585,14 @@ namespace ov
 		mutable std::recursive_mutex _dispatch_queue_lock;
 		std::deque<DispatchCommand> _dispatch_queue;
 		bool _has_close_command = false;
+		std::shared_ptr<const std::function<void()>> _dispatch_completed_callback;
+
+		// Batched egress (UDP only)
+		// If enabled, datagrams sent while a DatagramSendBatch is alive are queued and sent together using sendmmsg()
+		bool _batched_egress = false;
+		// Disabled when the kernel or NIC does not support UDP_SEGMENT
+		bool _gso_enabled = true;
+		std::unique_ptr<DatagramMessageBuilder> _datagram_builder;
 
 		std::atomic<bool> _connection_event_fired{false};
 		std::shared_ptr<SocketAsyncInterface> _callback;
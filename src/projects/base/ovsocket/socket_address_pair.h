@@ -85,6 +85,19 @@ namespace ov
 			return false;
 		}
 
+		// SocketAddress::Hash() is a XOR of the address and port, so the bits are mixed here
+		// to distribute the pairs evenly in the open addressing tables (splitmix64 finalizer)
+		std::size_t Hash() const
+		{
+			uint64_t hash = (static_cast<uint64_t>(_remote_address.Hash()) * 31) ^ static_cast<uint64_t>(_local_address.Hash());
+
+			hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+			hash = hash ^ (hash >> 31);
+
+			return static_cast<std::size_t>(hash);
+		}
+
 		String ToString() const
 		{
 			return String::FormatString(
@@ -99,3 +112,15 @@ namespace ov
 		SocketAddress _remote_address;
 	};
 }  // namespace ov
+
+namespace std
+{
+	template <>
+	struct hash<ov::SocketAddressPair>
+	{
+		std::size_t operator()(ov::SocketAddressPair const &pair) const
+		{
+			return pair.Hash();
+		}
+	};
+}  // namespace std
@@ -37,6 +37,16 @@ namespace ov
 	{
 	}
 
+	DatagramReceiveRing *SocketPoolWorker::GetDatagramReceiveRing()
+	{
+		if (_datagram_receive_ring == nullptr)
+		{
+			_datagram_receive_ring = std::make_unique<DatagramReceiveRing>();
+		}
+
+		return _datagram_receive_ring.get();
+	}
+
 	bool SocketPoolWorker::Initialize()
 	{
 		if (GetNativeHandle() != InvalidSocket)
@@ -48,6 +48,10 @@ namespace ov
 
 		bool ReleaseSocket(const std::shared_ptr<Socket> &socket);
 
+		// The receive buffers shared by all datagram sockets of this worker
+		// This API MUST be called in SocketPoolWorker::ThreadProc() thread
+		DatagramReceiveRing *GetDatagramReceiveRing();
+
 		String ToString() const;
 
 	protected:
@@ -134,6 +138,9 @@ namespace ov
 		// Related to epoll
 		socket_t _epoll = InvalidSocket;
 
+		// Created when a datagram socket of this worker receives data for the first time
+		std::unique_ptr<DatagramReceiveRing> _datagram_receive_ring;
+
 		// Related to SRT
 		SRTSOCKET _srt_epoll = InvalidSocket;
 		std::vector<SRT_EPOLL_EVENT> _srt_epoll_events;
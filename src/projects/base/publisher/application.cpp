@@ -2,17 +2,20 @@
 
 #include <algorithm>
 
+#include <monitoring/monitoring.h>
+
 #include "publisher.h"
 #include "publisher_private.h"
 
 namespace pub
 {
-	ApplicationWorker::ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name)
+	ApplicationWorker::ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name, PublisherType publisher_type)
 		: _stream_data_queue(nullptr, 500)
 	{
 		_worker_id = worker_id;
 		_vhost_app_name = vhost_app_name;
 		_worker_name = worker_name;
+		_publisher_type = publisher_type;
 		_stop_thread_flag = false;
 	}
 
@@ -94,6 +97,9 @@ namespace pub
 			auto stream_data = PopStreamData();
 			if ((stream_data != nullptr) && (stream_data->_stream != nullptr) && (stream_data->_media_packet != nullptr))
 			{
+				// The packet is shared by all publishers, so the dequeued time is kept until the packet is sent
+				int64_t dequeued_time_us = (stream_data->_media_packet->GetTrace() != nullptr) ? MediaTrace::GetCurrentTimeUs() : 0;
+
 				if (stream_data->_media_packet->GetMediaType() == cmn::MediaType::Video)
 				{
 					stream_data->_stream->SendVideoFrame(stream_data->_media_packet);
@@ -110,6 +116,19 @@ namespace pub
 				{
 					// Nothing can do
 				}
+
+				if (dequeued_time_us != 0)
+				{
+					auto trace = stream_data->_media_packet->GetTrace()->Clone();
+					trace->Mark(MediaTrace::Point::PublisherDequeued, dequeued_time_us);
+					trace->Mark(MediaTrace::Point::Published);
+
+					auto stream_metrics = MonitorInstance->GetStreamMetrics(*stream_data->_stream);
+					if (stream_metrics != nullptr)
+					{
+						stream_metrics->OnLatencyTraced(_publisher_type, *trace);
+					}
+				}
 			}
 		}
 	}
@@ -166,7 +185,7 @@ namespace pub
 
 		for (uint32_t i = 0; i < _application_worker_count; i++)
 		{
-			auto app_worker = std::make_shared<ApplicationWorker>(i, GetName().CStr(), StringFromPublisherType(_publisher->GetPublisherType()));
+			auto app_worker = std::make_shared<ApplicationWorker>(i, GetName().CStr(), StringFromPublisherType(_publisher->GetPublisherType()), _publisher->GetPublisherType());
 			if (app_worker->Start() == false)
 			{
 				logte("Cannot create ApplicationWorker (%s/%s/%d)", GetApplicationTypeName(), GetName().CStr(), i);
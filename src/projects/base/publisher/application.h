@@ -32,7 +32,7 @@ namespace pub
 	class ApplicationWorker
 	{
 	public:
-		ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name);
+		ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name, PublisherType publisher_type);
 		bool Start();
 		bool Stop();
 		bool PushMediaPacket(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet);
@@ -43,6 +43,7 @@ namespace pub
 		uint32_t	_worker_id = 0;
 		ov::String  _vhost_app_name;
 		ov::String	_worker_name;
+		PublisherType _publisher_type = PublisherType::Unknown;
 
 		class StreamData
 		{
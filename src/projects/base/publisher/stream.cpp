@@ -1,4 +1,8 @@
 #include "stream.h"
+
+#include <base/ovsocket/ovsocket.h>
+#include <monitoring/monitoring.h>
+
 #include "application.h"
 #include "publisher_private.h"
 
@@ -9,10 +13,12 @@ namespace pub
 	{
 		_stop_thread_flag = true;
 		_parent = parent_stream;
+		_parent->_packet_ring.AddReader(&_ring_reader);
 	}
 
 	StreamWorker::~StreamWorker()
 	{
+		_parent->_packet_ring.RemoveReader(&_ring_reader);
 	}
 
 	bool StreamWorker::Start()
@@ -129,6 +135,11 @@ namespace pub
 		_queue_event.Notify();
 	}
 
+	void StreamWorker::NotifyRingPacket()
+	{
+		_queue_event.Notify();
+	}
+
 	// Send to a specific session
 	void StreamWorker::SendMessage(const std::shared_ptr<Session> &session, const std::any &message)
 	{
@@ -178,7 +189,10 @@ namespace pub
 
 			auto packet = PopStreamPacket();
 			if (packet.has_value())
-			{		
+			{
+				// Datagrams sent by the sessions are sent together when the batch goes out of scope
+				ov::DatagramSendBatch batch;
+
 				session_lock.lock();
 				for (auto const &x : _sessions)
 				{
@@ -187,6 +201,45 @@ namespace pub
 				}
 				session_lock.unlock();
 			}
+
+			DispatchRingPackets();
+		}
+	}
+
+	void StreamWorker::DispatchRingPackets()
+	{
+		auto &ring = _parent->_packet_ring;
+		auto dispatcher = _parent->_packet_dispatcher;
+
+		if ((dispatcher == nullptr) || (ring.HasPacketToRead(&_ring_reader) == false))
+		{
+			return;
+		}
+
+		uint64_t skipped_count = 0;
+
+		{
+			// Datagrams sent by the sessions are sent together when the batch goes out of scope
+			ov::DatagramSendBatch batch;
+
+			std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+
+			skipped_count = ring.Read(&_ring_reader, [&](const std::shared_ptr<void> &packet) {
+				dispatcher(_sessions, packet);
+			});
+		}
+
+		if (skipped_count > 0)
+		{
+			logtw("%s/%s/%s - StreamWorker is too slow, %" PRIu64 " packets have been skipped (total: %" PRIu64 ")",
+				  _parent->GetApplicationTypeName(), _parent->GetApplicationName(), _parent->GetName().CStr(),
+				  skipped_count, _ring_reader.GetSkippedCount());
+
+			auto stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(_parent));
+			if (stream_metrics != nullptr)
+			{
+				stream_metrics->OnPacketsSkipped(skipped_count);
+			}
 		}
 	}
 
@@ -355,6 +408,12 @@ namespace pub
 
 	bool Stream::AddSession(std::shared_ptr<Session> session)
 	{
+		if ((_session_type_checker != nullptr) && (_session_type_checker(session) == false))
+		{
+			logte("Cannot add session %u: The type of the session is not matched with the registered packet type", session->GetId());
+			return false;
+		}
+
 		std::lock_guard<std::shared_mutex> session_lock(_session_map_mutex);
 		// For getting session, all sessions
 		_sessions[session->GetId()] = session;
@@ -436,6 +495,8 @@ namespace pub
 		}
 		else
 		{
+			ov::DatagramSendBatch batch;
+
 			std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
 			for (auto const &x : _sessions)
 			{
@@ -447,6 +508,29 @@ namespace pub
 		return true;
 	}
 
+	bool Stream::BroadcastTypedPacketInternal(std::shared_ptr<void> packet)
+	{
+		if (_worker_count > 0)
+		{
+			_packet_ring.Push(std::move(packet));
+
+			std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+			for (auto &stream_worker : _stream_workers)
+			{
+				stream_worker->NotifyRingPacket();
+			}
+		}
+		else
+		{
+			ov::DatagramSendBatch batch;
+
+			std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+			_packet_dispatcher(_sessions, packet);
+		}
+
+		return true;
+	}
+
 	bool Stream::SendMessage(const std::shared_ptr<Session> &session, const std::any &message)
 	{
 		if(_worker_count > 0)
@@ -7,6 +7,7 @@
 #include "base/mediarouter/media_buffer.h"
 #include "modules/managed_queue/managed_queue.h"
 #include "session.h"
+#include "stream_packet_ring.h"
 
 #define MAX_STREAM_WORKER_THREAD_COUNT 72
 
@@ -30,6 +31,8 @@ namespace pub
 
 		// Send to all sessions
 		void SendPacket(const std::any &packet);
+		// Wakes the worker up to dispatch the packets in the StreamPacketRing of the stream
+		void NotifyRingPacket();
 
 	private:
 		void WorkerThread();
@@ -42,6 +45,10 @@ namespace pub
 		std::optional<std::any> PopStreamPacket();
 		ov::ManagedQueue<std::any> _packet_queue;
 
+		// Dispatches the packets of the stream's StreamPacketRing (typed broadcast)
+		void DispatchRingPackets();
+		StreamPacketRing::Reader _ring_reader;
+
 		struct SessionMessage
 		{
 			SessionMessage(const std::shared_ptr<Session> &session, const std::any &message)
@@ -66,6 +73,8 @@ namespace pub
 	class Application;
 	class Stream : public info::Stream, public ov::EnableSharedFromThis<Stream>
 	{
+		friend class StreamWorker;
+
 	public:
 
 		// Create stream --> Start stream --> Stop stream --> Delete stream
@@ -90,6 +99,21 @@ namespace pub
 		// A child call this function to delivery packet to all sessions
 		bool BroadcastPacket(const std::any &packet);
 
+		// A child that has registered the packet type using RegisterPacketType<Tsession, Tpacket>() can call this function
+		// instead of BroadcastPacket(). The packet is stored once in a ring shared by all StreamWorkers,
+		// and it is delivered to Tsession::SendOutgoingPacket() without std::any_cast.
+		template <typename Tpacket>
+		bool BroadcastTypedPacket(const std::shared_ptr<Tpacket> &packet)
+		{
+			if (_packet_dispatcher == nullptr)
+			{
+				OV_ASSERT(false, "RegisterPacketType() must be called before BroadcastTypedPacket()");
+				return false;
+			}
+
+			return BroadcastTypedPacketInternal(std::static_pointer_cast<void>(packet));
+		}
+
 		bool SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
 		// Child must implement this function for packetizing and call BroadcastPacket to delivery to all sessions.
@@ -127,7 +151,40 @@ namespace pub
 		Stream(const std::shared_ptr<Application> application, const info::Stream &info);
 		virtual ~Stream();
 
+		// Registers the type of the packet sent by BroadcastTypedPacket() at compile time.
+		// All sessions of the stream must be Tsession, which has SendOutgoingPacket(const std::shared_ptr<Tpacket> &).
+		template <typename Tsession, typename Tpacket>
+		void RegisterPacketType()
+		{
+			_packet_dispatcher = &Stream::DispatchTypedPacket<Tsession, Tpacket>;
+			_session_type_checker = [](const std::shared_ptr<Session> &session) -> bool {
+				return dynamic_cast<Tsession *>(session.get()) != nullptr;
+			};
+		}
+
 	private:
+		using PacketDispatcher = void (*)(const std::map<session_id_t, std::shared_ptr<Session>> &sessions, const std::shared_ptr<void> &packet);
+		using SessionTypeChecker = bool (*)(const std::shared_ptr<Session> &session);
+
+		// Type dispatch is done once per packet, not once per session
+		template <typename Tsession, typename Tpacket>
+		static void DispatchTypedPacket(const std::map<session_id_t, std::shared_ptr<Session>> &sessions, const std::shared_ptr<void> &packet)
+		{
+			// The type of the sessions is checked in AddSession()
+			const auto typed_packet = std::static_pointer_cast<Tpacket>(packet);
+
+			for (const auto &[session_id, session] : sessions)
+			{
+				static_cast<Tsession *>(session.get())->SendOutgoingPacket(typed_packet);
+			}
+		}
+
+		bool BroadcastTypedPacketInternal(std::shared_ptr<void> packet);
+
+		PacketDispatcher _packet_dispatcher = nullptr;
+		SessionTypeChecker _session_type_checker = nullptr;
+		StreamPacketRing _packet_ring;
+
 		std::shared_ptr<StreamWorker> GetWorkerBySessionID(session_id_t session_id);
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
 		std::shared_mutex _session_map_mutex;
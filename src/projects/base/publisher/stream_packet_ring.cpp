@@ -0,0 +1,127 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "stream_packet_ring.h"
+
+#include <algorithm>
+
+namespace pub
+{
+	StreamPacketRing::StreamPacketRing(size_t capacity)
+	{
+		size_t slot_count = 2;
+
+		while (slot_count < capacity)
+		{
+			slot_count <<= 1;
+		}
+
+		_slots = std::make_unique<std::atomic<Node *>[]>(slot_count);
+		_mask = slot_count - 1;
+
+		for (size_t index = 0; index < slot_count; index++)
+		{
+			_slots[index].store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	StreamPacketRing::~StreamPacketRing()
+	{
+		for (size_t index = 0; index <= _mask; index++)
+		{
+			delete _slots[index].load(std::memory_order_relaxed);
+		}
+
+		for (auto &retired_node : _retired_nodes)
+		{
+			delete retired_node.node;
+		}
+
+		for (auto node : _free_nodes)
+		{
+			delete node;
+		}
+	}
+
+	void StreamPacketRing::AddReader(Reader *reader)
+	{
+		std::lock_guard<std::mutex> writer_lock(_writer_mutex);
+
+		reader->_cursor = GetHead();
+		reader->_epoch.store(UINT64_MAX, std::memory_order_seq_cst);
+
+		_readers.push_back(reader);
+	}
+
+	void StreamPacketRing::RemoveReader(Reader *reader)
+	{
+		std::lock_guard<std::mutex> writer_lock(_writer_mutex);
+
+		_readers.erase(std::remove(_readers.begin(), _readers.end(), reader), _readers.end());
+
+		ReleaseRetiredNodes();
+	}
+
+	void StreamPacketRing::Push(std::shared_ptr<void> packet)
+	{
+		std::lock_guard<std::mutex> writer_lock(_writer_mutex);
+
+		const auto sequence = _head.load(std::memory_order_relaxed);
+
+		Node *node = nullptr;
+
+		if (_free_nodes.empty())
+		{
+			node = new Node();
+		}
+		else
+		{
+			node = _free_nodes.back();
+			_free_nodes.pop_back();
+		}
+
+		node->sequence = sequence;
+		node->packet = std::move(packet);
+
+		// The readers that see the new head see the new node
+		auto old_node = _slots[sequence & _mask].exchange(node, std::memory_order_seq_cst);
+		_head.store(sequence + 1, std::memory_order_seq_cst);
+
+		if (old_node != nullptr)
+		{
+			_retired_nodes.push_back({sequence, old_node});
+		}
+
+		ReleaseRetiredNodes();
+	}
+
+	void StreamPacketRing::ReleaseRetiredNodes()
+	{
+		if (_retired_nodes.empty())
+		{
+			return;
+		}
+
+		// A reader that started to read at the epoch E may still use the nodes replaced at the sequence E or later
+		auto min_epoch = UINT64_MAX;
+
+		for (auto reader : _readers)
+		{
+			min_epoch = std::min(min_epoch, reader->_epoch.load(std::memory_order_seq_cst));
+		}
+
+		while ((_retired_nodes.empty() == false) && (_retired_nodes.front().sequence < min_epoch))
+		{
+			auto node = _retired_nodes.front().node;
+			_retired_nodes.pop_front();
+
+			node->packet.reset();
+			_free_nodes.push_back(node);
+		}
+	}
+}  // namespace pub
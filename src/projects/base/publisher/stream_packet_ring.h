@@ -0,0 +1,154 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// The ring keeps the last N packets alive, so it should not be too large
+#define STREAM_PACKET_RING_DEFAULT_CAPACITY 1024
+
+namespace pub
+{
+	// A ring buffer of packets shared by all StreamWorkers of a stream.
+	// The stream writes a packet once, and each StreamWorker reads it with its own cursor,
+	// so the packet doesn't need to be pushed to the queue of every worker.
+	//
+	// Readers don't lock the slots. A slot points to an immutable node (sequence + packet), and the writer replaces the node
+	// instead of modifying it. While reading, a reader holds an epoch (the head at the time it started to read),
+	// and the replaced nodes are not released until every reader has left the epochs in which the nodes were reachable.
+	//
+	// If a reader falls behind more than the capacity, the overwritten packets are skipped for that reader.
+	class StreamPacketRing
+	{
+	public:
+		class Reader
+		{
+		public:
+			// The number of packets skipped because the reader was too slow
+			uint64_t GetSkippedCount() const
+			{
+				return _skipped_count;
+			}
+
+		private:
+			friend class StreamPacketRing;
+
+			// The head when the reader started to read, or UINT64_MAX if the reader is not reading
+			std::atomic<uint64_t> _epoch{UINT64_MAX};
+			// The sequence of the next packet to read
+			uint64_t _cursor = 0;
+			uint64_t _skipped_count = 0;
+		};
+
+		explicit StreamPacketRing(size_t capacity = STREAM_PACKET_RING_DEFAULT_CAPACITY);
+		~StreamPacketRing();
+
+		// The reader starts to read from the next packet to be pushed
+		void AddReader(Reader *reader);
+		// Must not be called while the reader is reading
+		void RemoveReader(Reader *reader);
+
+		void Push(std::shared_ptr<void> packet);
+
+		// The sequence of the next packet to be pushed
+		uint64_t GetHead() const
+		{
+			return _head.load(std::memory_order_seq_cst);
+		}
+
+		bool HasPacketToRead(const Reader *reader) const
+		{
+			return reader->_cursor < GetHead();
+		}
+
+		// Calls on_packet(const std::shared_ptr<void> &packet) for each packet that the reader has not read yet.
+		// The packet is valid only during the call, so on_packet must copy it to keep it.
+		// Returns the number of packets skipped in this call (they had been overwritten before the reader read them).
+		template <typename Tfunction>
+		uint64_t Read(Reader *reader, const Tfunction &on_packet)
+		{
+			const auto head = GetHead();
+
+			if (reader->_cursor >= head)
+			{
+				return 0;
+			}
+
+			// The nodes that are reachable from now on are not released until the epoch is cleared
+			reader->_epoch.store(head, std::memory_order_seq_cst);
+
+			const uint64_t capacity = _mask + 1;
+			uint64_t skipped_count = 0;
+
+			while (reader->_cursor < head)
+			{
+				if ((head - reader->_cursor) > capacity)
+				{
+					// The reader is too slow
+					skipped_count += (head - capacity) - reader->_cursor;
+					reader->_cursor = head - capacity;
+				}
+
+				const auto node = _slots[reader->_cursor & _mask].load(std::memory_order_seq_cst);
+
+				if ((node == nullptr) || (node->sequence != reader->_cursor))
+				{
+					// Overwritten by a newer packet while reading
+					skipped_count++;
+				}
+				else
+				{
+					on_packet(node->packet);
+				}
+
+				reader->_cursor++;
+			}
+
+			reader->_epoch.store(UINT64_MAX, std::memory_order_release);
+			reader->_skipped_count += skipped_count;
+
+			return skipped_count;
+		}
+
+	private:
+		// Not modified while it is in a slot
+		struct Node
+		{
+			uint64_t sequence = 0;
+			std::shared_ptr<void> packet;
+		};
+
+		struct RetiredNode
+		{
+			// The node was replaced by the packet of this sequence
+			uint64_t sequence;
+			Node *node;
+		};
+
+		// Must be called with _writer_mutex
+		void ReleaseRetiredNodes();
+
+		std::unique_ptr<std::atomic<Node *>[]> _slots;
+		size_t _mask = 0;
+
+		std::atomic<uint64_t> _head{0};
+
+		// The members below are used only by the writer (and AddReader/RemoveReader)
+		std::mutex _writer_mutex;
+		std::vector<Reader *> _readers;
+		// The nodes replaced in the slots, in the order of the sequence
+		std::deque<RetiredNode> _retired_nodes;
+		// The released nodes are reused to avoid allocating a node for every packet
+		std::vector<Node *> _free_nodes;
+	};
+}  // namespace pub
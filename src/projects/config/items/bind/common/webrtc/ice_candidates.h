@@ -25,6 +25,8 @@ namespace cfg
 				int _tcp_relay_worker_count{};
 				int _ice_worker_count{};
 				bool _tcp_force = false;
+				// Send the RTP/RTCP packets of many sessions together using sendmmsg()/UDP_SEGMENT
+				bool _enable_batched_egress = false;
 
 			public:
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetIceCandidateList, _ice_candidate_list);
@@ -35,6 +37,7 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetTcpRelayWorkerCount, _tcp_relay_worker_count);
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetIceWorkerCount, _ice_worker_count);
 				CFG_DECLARE_CONST_REF_GETTER_OF(IsTcpForce, _tcp_force)
+				CFG_DECLARE_CONST_REF_GETTER_OF(IsBatchedEgressEnabled, _enable_batched_egress)
 
 			protected:
 				void MakeList() override
@@ -47,6 +50,7 @@ namespace cfg
 					Register<Optional>("TcpRelayWorkerCount", &_tcp_relay_worker_count);
 					Register<Optional>("IceWorkerCount", &_ice_worker_count);
 					Register<Optional>("TcpForce", &_tcp_force);
+					Register<Optional>("EnableBatchedEgress", &_enable_batched_egress);
 				}
 			};
 		}  // namespace cmm
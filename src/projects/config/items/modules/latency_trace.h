@@ -0,0 +1,50 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct LatencyTrace : public ModuleTemplate
+		{
+		protected:
+			int _sample_interval = 100;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSampleInterval, _sample_interval)
+
+		protected:
+			void MakeList() override
+			{
+				// Disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+
+				/**
+					Measures how long the sampled packets spend in each stage of the pipeline
+					(MediaRouter, Transcoder, Publisher), and shows it in the stream stats API.
+
+					server.xml:
+						<Modules>
+							<LatencyTrace>
+								<Enable>true</Enable>
+								<!-- One of every N packets of an input stream is traced -->
+								<SampleInterval>100</SampleInterval>
+							</LatencyTrace>
+						</Modules>
+				*/
+				Register<Optional>("SampleInterval", &_sample_interval);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
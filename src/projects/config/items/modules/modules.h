@@ -9,9 +9,11 @@
 #pragma once
 
 #include "http2.h"
+#include "latency_trace.h"
 #include "ll_hls.h"
 #include "p2p.h"
 #include "recovery.h"
+#include "transcoder.h"
 
 namespace cfg
 {
@@ -24,12 +26,16 @@ namespace cfg
 			LLHls _ll_hls;
 			P2P _p2p;
 			Recovery _recovery;
+			Transcoder _transcoder;
+			LatencyTrace _latency_trace;
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetHttp2, _http2)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetLLHls, _ll_hls)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetP2P, _p2p)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetRecovery, _recovery)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetTranscoder, _transcoder)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetLatencyTrace, _latency_trace)
 
 		protected:
 			void MakeList() override
@@ -38,6 +44,8 @@ namespace cfg
 				Register<Optional>("LLHLS", &_ll_hls);
 				Register<Optional>({"P2P", "p2p"}, &_p2p);
 				Register<Optional>("Recovery", &_recovery);
+				Register<Optional>("Transcoder", &_transcoder);
+				Register<Optional>("LatencyTrace", &_latency_trace);
 			}
 		};
 	}  // namespace modules
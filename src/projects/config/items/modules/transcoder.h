@@ -0,0 +1,61 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct Transcoder : public Item
+		{
+		protected:
+			// 0 means the number of CPU cores
+			int _decoder_thread_count = 0;
+			int _filter_thread_count = 0;
+			int _encoder_thread_count = 0;
+
+			// Rescales a decoded frame to all the renditions in one filter graph
+			bool _multi_output_rescaler = true;
+			// Scales each rendition from the next larger rendition instead of the source
+			bool _cascade_rescaler = false;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetDecoderThreadCount, _decoder_thread_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetFilterThreadCount, _filter_thread_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetEncoderThreadCount, _encoder_thread_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsMultiOutputRescalerEnabled, _multi_output_rescaler)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsCascadeRescalerEnabled, _cascade_rescaler)
+
+		protected:
+			void MakeList() override
+			{
+				/**
+					Decoders, filters and encoders of all streams are run by the thread pool of each stage
+					instead of a thread per component.
+
+					server.xml:
+						<Modules>
+							<Transcoder>
+								<DecoderThreadCount>0</DecoderThreadCount>
+								<FilterThreadCount>0</FilterThreadCount>
+								<EncoderThreadCount>0</EncoderThreadCount>
+								<MultiOutputRescaler>true</MultiOutputRescaler>
+								<CascadeRescaler>false</CascadeRescaler>
+							</Transcoder>
+						</Modules>
+				*/
+				Register<Optional>("DecoderThreadCount", &_decoder_thread_count);
+				Register<Optional>("FilterThreadCount", &_filter_thread_count);
+				Register<Optional>("EncoderThreadCount", &_encoder_thread_count);
+				Register<Optional>("MultiOutputRescaler", &_multi_output_rescaler);
+				Register<Optional>("CascadeRescaler", &_cascade_rescaler);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -22,6 +22,7 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetControlServerUrl, _control_server_url)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetSecretKey, _secret_key)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetTimeoutMsec, _timeout_msec)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetCacheTTLMsec, _cache_ttl_msec)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledProviders, _enables.GetProviders().GetValue())
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledPublishers, _enables.GetPublishers().GetValue())
 
@@ -43,12 +44,15 @@ namespace cfg
 					Register("ControlServerUrl", &_control_server_url);
 					Register("SecretKey", &_secret_key);
 					Register("Timeout", &_timeout_msec);
+					Register<Optional>("CacheTTL", &_cache_ttl_msec);
 					Register("Enables", &_enables);
 				}
 
 				ov::String _control_server_url;
 				ov::String _secret_key;
 				int _timeout_msec = 3000;
+				// 0: Decisions are not cached
+				int _cache_ttl_msec = 0;
 
 				Enables _enables;
 			};
@@ -22,16 +22,19 @@ namespace cfg
 				{
 				protected:
 					bool _hwaccel = false;
+					bool _auto_bypass = false;
 					std::vector<OutputProfile> _output_profiles;
 
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsHardwareAcceleration, _hwaccel);
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsAutoBypass, _auto_bypass);
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetOutputProfileList, _output_profiles);
 
 				protected:
 					void MakeList() override
 					{
 						Register<Optional>("HardwareAcceleration", &_hwaccel);
+						Register<Optional>("AutoBypass", &_auto_bypass);
 						Register<Optional>("OutputProfile", &_output_profiles);
 					}
 				};
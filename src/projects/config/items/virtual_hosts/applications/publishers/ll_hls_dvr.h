@@ -22,11 +22,14 @@ namespace cfg
 					bool _enabled = false;
 					ov::String _temp_storage_path = "/tmp/ll_hls_dvr";
 					int _max_duration = 3600;
+					// MB
+					int _max_cache_size = 64;
 
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enabled)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetTempStoragePath, _temp_storage_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxDuration, _max_duration)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxCacheSize, _max_cache_size)
 
 				protected:
 					void MakeList() override
@@ -34,6 +37,7 @@ namespace cfg
 						Register<Optional>("Enable", &_enabled);
 						Register<Optional>("TempStoragePath", &_temp_storage_path);
 						Register<Optional>("MaxDuration", &_max_duration);
+						Register<Optional>("MaxCacheSize", &_max_cache_size);
 						
 					}
 				};
@@ -47,6 +47,8 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsRtxEnabled, _rtx)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsUlpfecEnalbed, _ulpfec)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsJitterBufferEnabled, _jitter_buffer)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsZeroCopyFanOutEnabled, _zero_copy_fan_out)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsAesGcmPreferred, _prefer_aes_gcm)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPlayoutDelay, _playout_delay)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBandwidthEstimationType, _bandwidth_estimation_type)
 
@@ -59,6 +61,8 @@ namespace cfg
 						Register<Optional>("JitterBuffer", &_jitter_buffer);
 						Register<Optional>("Rtx", &_rtx);
 						Register<Optional>("Ulpfec", &_ulpfec);
+						Register<Optional>("ZeroCopyFanOut", &_zero_copy_fan_out);
+						Register<Optional>("PreferAesGcm", &_prefer_aes_gcm);
 						Register<Optional>("PlayoutDelay", &_playout_delay);
 						Register<Optional>("BandwidthEstimation", &_bwe,	
 							[=]() -> std::shared_ptr<ConfigError> {
@@ -88,6 +92,10 @@ namespace cfg
 					bool _rtx = false;
 					bool _ulpfec = false;
 					bool _jitter_buffer = false;
+					// Sessions share the packetized RTP packet and only rewrite the header into their own buffer
+					bool _zero_copy_fan_out = true;
+					// Select AES-GCM SRTP profiles if the peer offers them
+					bool _prefer_aes_gcm = true;
 					ov::String _bwe;
 
 					WebRtcBandwidthEstimationType _bandwidth_estimation_type = WebRtcBandwidthEstimationType::REMB;
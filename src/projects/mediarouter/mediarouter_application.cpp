@@ -9,6 +9,7 @@
 #include "mediarouter_application.h"
 
 #include <base/info/stream.h>
+#include <config/config_manager.h>
 
 #include "mediarouter_private.h"
 #include "monitoring/monitoring.h"
@@ -48,21 +49,22 @@ MediaRouteApplication::MediaRouteApplication(const info::Application &applicatio
 {
 	_max_worker_thread_count = std::min(std::max((uint32_t)_application_info.GetConfig().GetPublishers().GetAppWorkerCount(), (uint32_t)MIN_APPLICATION_WORKER_COUNT), (uint32_t)MAX_APPLICATION_WORKER_COUNT);
 
+	auto &latency_trace_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetLatencyTrace();
+	if (latency_trace_config.IsEnabled())
+	{
+		_latency_trace_interval = std::max(latency_trace_config.GetSampleInterval(), 1);
+	}
+
 	logti("[%s(%u)] Created Mediarouter application. worker(%d)", _application_info.GetName().CStr(), _application_info.GetId(), _max_worker_thread_count);
 
-	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
 	{
-		{
-			auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetName(), nullptr, "imr", ov::String::FormatString("aw_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn, 500);
-			_inbound_stream_indicator.push_back(stream_data);
-		}
+		auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetName(), nullptr, "imr", "ready");
+		_inbound_ready_queue = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn, 500);
+	}
 
-		{
-			auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetName(), nullptr, "omr", ov::String::FormatString("aw_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn, 500);
-			_outbound_stream_indicator.push_back(stream_data);
-		}
+	{
+		auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetName(), nullptr, "omr", "ready");
+		_outbound_ready_queue = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn, 500);
 	}
 }
 
@@ -117,17 +119,11 @@ bool MediaRouteApplication::Stop()
 {
 	_kill_flag = true;
 
-	for (auto &indicator : _inbound_stream_indicator)
-	{
-		indicator->Stop();
-		indicator->Clear();
-	}
+	_inbound_ready_queue->Stop();
+	_inbound_ready_queue->Clear();
 
-	for (auto &indicator : _outbound_stream_indicator)
-	{
-		indicator->Stop();
-		indicator->Clear();
-	}
+	_outbound_ready_queue->Stop();
+	_outbound_ready_queue->Clear();
 
 	for (auto &worker : _inbound_threads)
 	{
@@ -145,8 +141,6 @@ bool MediaRouteApplication::Stop()
 		}
 	}
 
-	_inbound_stream_indicator.clear();
-	_outbound_stream_indicator.clear();
 	_inbound_threads.clear();
 	_outbound_threads.clear();
 
@@ -637,9 +631,16 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouteApp
 			return false;
 		}
 
+		if ((_latency_trace_interval > 0) && stream->SampleTrace(_latency_trace_interval))
+		{
+			auto trace = std::make_shared<MediaTrace>();
+			trace->Mark(MediaTrace::Point::RouterInbound);
+			packet->SetTrace(trace);
+		}
+
 		stream->Push(packet);
 
-		_inbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		ScheduleStream(_inbound_ready_queue, stream);
 	}
 	// Provider(relay), Transcoder => Outbound Stream
 	else if ((IS_CONNECTOR_PROVIDER(connector_type) && IS_REPRENT_RELAY(representation_type)) ||
@@ -651,9 +652,14 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouteApp
 			return false;
 		}
 
+		if (packet->GetTrace() != nullptr)
+		{
+			packet->GetTrace()->Mark(MediaTrace::Point::RouterOutbound);
+		}
+
 		stream->Push(packet);
 
-		_outbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		ScheduleStream(_outbound_ready_queue, stream);
 	}
 	else
 	{
@@ -738,9 +744,12 @@ bool MediaRouteApplication::IsExistingInboundStream(ov::String stream_name)
 	return false;
 }
 
-uint32_t MediaRouteApplication::GetWorkerIDByStreamID(info::stream_id_t stream_id)
+void MediaRouteApplication::ScheduleStream(const std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>> &ready_queue, const std::shared_ptr<MediaRouteStream> &stream)
 {
-	return stream_id % _max_worker_thread_count;
+	if (stream->MarkRunnable())
+	{
+		ready_queue->Enqueue(stream);
+	}
 }
 
 void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
@@ -749,7 +758,7 @@ void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 
 	while (!_kill_flag)
 	{
-		auto msg = _inbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
+		auto msg = _inbound_ready_queue->Dequeue(ov::Infinite);
 		if (msg.has_value() == false)
 		{
 			// It may be called due to a normal stop signal.
@@ -762,34 +771,49 @@ void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
+		// Drain the packets pushed so far at once. Packets pushed while draining are handled in the next turn,
+		// so a busy stream doesn't starve the other streams.
+		auto pending_count = stream->GetPendingPacketCount();
+		for (size_t index = 0; (index < pending_count) && (_kill_flag == false); index++)
 		{
-			continue;
-		}
+			// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+			auto media_packet = stream->Pop();
+			if (media_packet == nullptr)
+			{
+				continue;
+			}
 
-		// When the inbound stream is finished parsing track information,
-		// Notify the Observer that the stream is parsed
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
-		{
-			NotifyStreamPrepared(stream);
-		}
+			if (media_packet->GetTrace() != nullptr)
+			{
+				media_packet->GetTrace()->Mark(MediaTrace::Point::InboundDelivered);
+			}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
-		{
-			auto observer_type = observer->GetObserverType();
+			// When the inbound stream is finished parsing track information,
+			// Notify the Observer that the stream is parsed
+			if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
+			{
+				NotifyStreamPrepared(stream);
+			}
 
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder)
+			std::shared_lock<std::shared_mutex> lock(_observers_lock);
+			for (const auto &observer : _observers)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
+				auto observer_type = observer->GetObserverType();
+
+				if (observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder)
+				{
+					// Get Stream Info
+					auto stream_info = stream->GetStream();
 
-				// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
-				observer->OnSendFrame(stream_info, media_packet);
+					observer->OnSendFrame(stream_info, media_packet);
+				}
 			}
 		}
+
+		if (stream->ClearRunnable())
+		{
+			_inbound_ready_queue->Enqueue(stream);
+		}
 	}
 
 	logtd("Inbound worker thread #%d has been stopped", worker_id);
@@ -801,7 +825,7 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 
 	while (!_kill_flag)
 	{
-		auto msg = _outbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
+		auto msg = _outbound_ready_queue->Dequeue(ov::Infinite);
 		if (msg.has_value() == false)
 		{
 			// It may be called due to a normal stop signal.
@@ -814,31 +838,45 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
+		auto pending_count = stream->GetPendingPacketCount();
+		for (size_t index = 0; (index < pending_count) && (_kill_flag == false); index++)
 		{
-			continue;
-		}
+			// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+			auto media_packet = stream->Pop();
+			if (media_packet == nullptr)
+			{
+				continue;
+			}
 
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
-		{
-			NotifyStreamPrepared(stream);
-		}
+			if (media_packet->GetTrace() != nullptr)
+			{
+				media_packet->GetTrace()->Mark(MediaTrace::Point::OutboundDelivered);
+			}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
-		{
-			auto observer_type = observer->GetObserverType();
+			if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
+			{
+				NotifyStreamPrepared(stream);
+			}
 
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Publisher)
+			std::shared_lock<std::shared_mutex> lock(_observers_lock);
+			for (const auto &observer : _observers)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
+				auto observer_type = observer->GetObserverType();
+
+				if (observer_type == MediaRouteApplicationObserver::ObserverType::Publisher)
+				{
+					// Get Stream Info
+					auto stream_info = stream->GetStream();
 
-				observer->OnSendFrame(stream_info, media_packet);
+					observer->OnSendFrame(stream_info, media_packet);
+				}
 			}
 		}
+
+		if (stream->ClearRunnable())
+		{
+			_outbound_ready_queue->Enqueue(stream);
+		}
 	}
 
 	logtd("Outbound worker thread #%d has been stopped", worker_id);
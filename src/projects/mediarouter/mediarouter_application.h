@@ -138,7 +138,8 @@ private:
 	std::shared_mutex _streams_lock;
 
 private:
-	uint32_t GetWorkerIDByStreamID(info::stream_id_t stream_id);
+	// Puts the stream into the ready queue if it is not already runnable
+	void ScheduleStream(const std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>> &ready_queue, const std::shared_ptr<MediaRouteStream> &stream);
 	void InboundWorkerThread(uint32_t worker_id);
 	void OutboundWorkerThread(uint32_t worker_id);
 
@@ -148,7 +149,13 @@ private:
 
 	uint32_t _max_worker_thread_count;
 
+	// One of every N packets of an inbound stream is traced (0: disabled)
+	uint32_t _latency_trace_interval = 0;
+
 private:
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>> _inbound_stream_indicator;
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>> _outbound_stream_indicator;
+	// Runnable streams, shared by all workers of each direction.
+	// A stream appears at most once in the queue (see MediaRouteStream::MarkRunnable()),
+	// and it is taken by whichever worker becomes idle first, so the load is balanced across the workers.
+	std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>> _inbound_ready_queue;
+	std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>> _outbound_ready_queue;
 };
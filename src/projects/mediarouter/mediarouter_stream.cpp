@@ -50,7 +50,7 @@ using namespace cmn;
 
 MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream)
 	: _stream(stream),
-	  _packets_queue(nullptr, 100)
+	  _packets_queue(nullptr, 100, MEDIA_ROUTE_STREAM_QUEUE_CAPACITY)
 {
 	_inout_type = MediaRouterStreamType::UNKNOWN;
 
@@ -69,12 +69,23 @@ MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream,
 
 MediaRouteStream::~MediaRouteStream()
 {
-	_media_packet_stash.clear();
+	_track_states.clear();
+}
+
+MediaRouteStream::TrackState &MediaRouteStream::GetTrackState(MediaTrackId track_id)
+{
+	for (auto &track_state : _track_states)
+	{
+		if (track_state.track_id == track_id)
+		{
+			return track_state;
+		}
+	}
 
-	_stat_recv_pkt_lpts.clear();
-	_stat_recv_pkt_ldts.clear();
+	auto &track_state = _track_states.emplace_back();
+	track_state.track_id = track_id;
 
-	_pts_last.clear();
+	return track_state;
 }
 
 std::shared_ptr<info::Stream> MediaRouteStream::GetStream()
@@ -114,7 +125,10 @@ void MediaRouteStream::Flush()
 	// Clear queued packets
 	_packets_queue.Clear();
 	// Clear stashed Packets
-	_media_packet_stash.clear();
+	for (auto &track_state : _track_states)
+	{
+		track_state.stashed_packet = nullptr;
+	}
 
 	_are_all_tracks_parsed = false;
 
@@ -754,6 +768,7 @@ bool MediaRouteStream::AreAllTracksReady()
 void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
 {
 	auto track_id = media_track->GetId();
+	auto &track_state = GetTrackState(track_id);
 
 	// Check b-frame of H264/H265 codec
 	//
@@ -767,7 +782,7 @@ void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track
 		case cmn::BitstreamFormat::HVCC:
 			if (_warning_count_bframe < 10)
 			{
-				if (media_track->GetTotalFrameCount() > 0 && _stat_recv_pkt_lpts[track_id] > media_packet->GetPts())
+				if (media_track->GetTotalFrameCount() > 0 && track_state.stat_recv_pkt_lpts > media_packet->GetPts())
 				{
 					media_track->SetHasBframes(true);
 				}
@@ -790,8 +805,8 @@ void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track
 			break;
 	}
 
-	_stat_recv_pkt_lpts[track_id] = media_packet->GetPts();
-	_stat_recv_pkt_ldts[track_id] = media_packet->GetDts();
+	track_state.stat_recv_pkt_lpts = media_packet->GetPts();
+	track_state.stat_recv_pkt_ldts = media_packet->GetDts();
 
 	if (_stop_watch.IsElapsed(30000) && _stop_watch.Update())
 	{
@@ -805,7 +820,7 @@ void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track
 
 		for (const auto &[track_id, track] : _stream->GetTracks())
 		{
-			int64_t rescaled_last_pts = (int64_t)((double)(_stat_recv_pkt_lpts[track_id] * 1000) * track->GetTimeBase().GetExpr());
+			int64_t rescaled_last_pts = (int64_t)((double)(GetTrackState(track_id).stat_recv_pkt_lpts * 1000) * track->GetTimeBase().GetExpr());
 
 			// Time difference in pts values relative to uptime
 			int64_t last_delay = uptime - rescaled_last_pts;
@@ -958,7 +973,59 @@ void MediaRouteStream::DropNonDecodingPackets()
 
 void MediaRouteStream::Push(std::shared_ptr<MediaPacket> media_packet)
 {
-	_packets_queue.Enqueue(std::move(media_packet));
+	const auto track_id = media_packet->GetTrackId();
+	const bool is_video = (media_packet->GetMediaType() == cmn::MediaType::Video);
+
+	if (is_video && (_key_frame_waiting_track_count.load(std::memory_order_relaxed) > 0))
+	{
+		std::lock_guard<std::mutex> lock_guard(_key_frame_waiting_mutex);
+
+		auto it = _key_frame_waiting_tracks.find(track_id);
+		if (it != _key_frame_waiting_tracks.end())
+		{
+			if (media_packet->GetFlag() != MediaPacketFlag::Key)
+			{
+				it->second++;
+				return;
+			}
+
+			logtw("[%s/%s(%u)] Track %u is resumed from a key frame, %u packets have been dropped since the queue was full",
+				  _stream->GetApplicationName(), _stream->GetName().CStr(), _stream->GetId(), track_id, it->second);
+
+			_key_frame_waiting_tracks.erase(it);
+			_key_frame_waiting_track_count.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	if ((_packets_queue.Enqueue(std::move(media_packet)) == false) && is_video)
+	{
+		// An audio frame can be decoded alone, but a video packet after the lost one is useless until the next key frame
+		std::lock_guard<std::mutex> lock_guard(_key_frame_waiting_mutex);
+
+		if (_key_frame_waiting_tracks.emplace(track_id, 1).second)
+		{
+			_key_frame_waiting_track_count.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+size_t MediaRouteStream::GetPendingPacketCount() const
+{
+	return _packets_queue.Size();
+}
+
+bool MediaRouteStream::MarkRunnable()
+{
+	// acq_rel: If a worker has cleared the flag, the packets it popped are visible here, and vice versa
+	return (_runnable.exchange(true, std::memory_order_acq_rel) == false);
+}
+
+bool MediaRouteStream::ClearRunnable()
+{
+	_runnable.exchange(false, std::memory_order_acq_rel);
+
+	// A packet pushed before the flag is cleared would not have scheduled the stream
+	return (_packets_queue.IsEmpty() == false) && MarkRunnable();
 }
 
 std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
@@ -1001,15 +1068,15 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 		// The packet duration recalculation applies only to video and audio types.
 		(media_packet->GetMediaType() == MediaType::Video || media_packet->GetMediaType() == MediaType::Audio))
 	{
-		auto it = _media_packet_stash.find(media_packet->GetTrackId());
-		if (it == _media_packet_stash.end())
+		auto &track_state = GetTrackState(media_packet->GetTrackId());
+		if (track_state.stashed_packet == nullptr)
 		{
-			_media_packet_stash[media_packet->GetTrackId()] = std::move(media_packet);
+			track_state.stashed_packet = std::move(media_packet);
 
 			return nullptr;
 		}
 
-		pop_media_packet = std::move(it->second);
+		pop_media_packet = std::move(track_state.stashed_packet);
 
 		// [#743] Recording and HLS packetizing are failing due to non-monotonically increasing dts.
 		// So, the code below is a temporary measure to avoid this problem. A more fundamental solution should be considered.
@@ -1030,7 +1097,7 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 		int64_t duration = media_packet->GetDts() - pop_media_packet->GetDts();
 		pop_media_packet->SetDuration(duration);
 
-		_media_packet_stash[media_packet->GetTrackId()] = std::move(media_packet);
+		track_state.stashed_packet = std::move(media_packet);
 	}
 	else
 	{
@@ -1078,30 +1145,32 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 	// Detect abnormal increases in PTS.
 	if (GetInoutType() == MediaRouterStreamType::INBOUND)
 	{
-		auto it = _pts_last.find(track_id);
-		if (it != _pts_last.end())
+		auto &track_state = GetTrackState(track_id);
+		int64_t ts_ms = pop_media_packet->GetPts() * media_track->GetTimeBase().GetExpr() * 1000;
+
+		if (track_state.has_last_pts_ms)
 		{
-			int64_t ts_ms = pop_media_packet->GetPts() * media_track->GetTimeBase().GetExpr();
-			int64_t ts_diff_ms = ts_ms - _pts_last[track_id];
+			int64_t ts_diff_ms = ts_ms - track_state.last_pts_ms;
 
 			if (std::abs(ts_diff_ms) > PTS_CORRECT_THRESHOLD_MS)
 			{
 				if (IsImageCodec(media_track->GetCodecId()) == false)
 				{
-					logtw("[%s/%s(%u)] Detected abnormal increased timestamp. track:%u last.pts: %lld, cur.pts: %lld, tb(%d/%d), diff: %lldms",
+					logtw("[%s/%s(%u)] Detected abnormal increased timestamp. track:%u last.pts: %lldms, cur.pts: %lld, tb(%d/%d), diff: %lldms",
 						  _stream->GetApplicationInfo().GetName().CStr(),
 						  _stream->GetName().CStr(),
 						  _stream->GetId(),
-						  track_id, _pts_last[track_id],
+						  track_id, track_state.last_pts_ms,
 						  pop_media_packet->GetPts(),
 						  media_track->GetTimeBase().GetNum(),
 						  media_track->GetTimeBase().GetDen(),
 						  ts_diff_ms);
 				}
 			}
-
-			_pts_last[track_id] = ts_ms;
 		}
+
+		track_state.has_last_pts_ms = true;
+		track_state.last_pts_ms = ts_ms;
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -10,15 +10,21 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 #include "base/info/stream.h"
 #include "base/mediarouter/media_buffer.h"
 #include "base/mediarouter/mediarouter_application_connector.h"
 #include "base/mediarouter/media_type.h"
-#include "modules/managed_queue/managed_queue.h"
+#include "modules/managed_queue/mpsc_managed_queue.h"
+
+// Capacity of the packet queue of a stream (the threshold is 100, so it is only reached when the worker is stalled)
+#define MEDIA_ROUTE_STREAM_QUEUE_CAPACITY 1024
 
 enum class MediaRouterStreamType : int8_t
 {
@@ -44,6 +50,24 @@ public:
 	bool NormalizeMediaPacket(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
 
 	std::shared_ptr<MediaPacket> Pop();
+	size_t GetPendingPacketCount() const;
+
+	// Ready-set scheduling
+	//
+	// A stream is put into the ready queue of MediaRouteApplication only once until a worker drains it,
+	// so that a burst of packets costs one queue operation and one wakeup.
+	//
+	// Returns true if the stream has become runnable by this call (the caller must enqueue the stream)
+	bool MarkRunnable();
+	// Called by the worker after draining the packets
+	// Returns true if packets were pushed while draining (the caller must enqueue the stream again)
+	bool ClearRunnable();
+
+	// Returns true for one of every interval calls (used for sampling the packets to trace)
+	bool SampleTrace(uint32_t interval)
+	{
+		return (_trace_sample_count.fetch_add(1, std::memory_order_relaxed) % interval) == 0;
+	}
 
 	// Query original stream information
 	std::shared_ptr<info::Stream> GetStream();
@@ -83,30 +107,41 @@ private:
 	// Stream Information
 	std::shared_ptr<info::Stream> _stream = nullptr;
 
-	// Temporary packet store. for calculating packet duration
-	std::map<MediaTrackId, std::shared_ptr<MediaPacket>> _media_packet_stash;
-
 	// Packets queue
-	ov::ManagedQueue<std::shared_ptr<MediaPacket>> _packets_queue;
-
-	// TODO(Soulk) : Modified to use by tying statistical information into a class and creating a map with MediaTrackId as a key
-
-	// Store the correction values in case of sudden change in PTS.
-	// If the PTS suddenly increases, the filter behaves incorrectly.
-	std::map<MediaTrackId, int64_t> _pts_last;
-
-	// <TrackId, Pts>
-	std::map<MediaTrackId, int64_t> _pts_correct;
-	// Average Pts Increment
-	std::map<MediaTrackId, int64_t> _pts_avg_inc;
-
-	// Timebase of incoming packets
-	std::map<MediaTrackId, cmn::Timebase> _incoming_timebase;
-
-	// Statistics
-	// <TrackId, Values>
-	std::map<MediaTrackId, int64_t> _stat_recv_pkt_lpts;
-	std::map<MediaTrackId, int64_t> _stat_recv_pkt_ldts;
+	// Pushed by the provider, and popped by the worker of MediaRouteApplication
+	ov::MpscManagedQueue<std::shared_ptr<MediaPacket>> _packets_queue;
+	// true while the stream is in the ready queue or is being drained by a worker
+	std::atomic<bool> _runnable{false};
+
+	// Video tracks that lost a packet because the queue was full, and the number of packets dropped since then.
+	// The following packets of these tracks are dropped until the next key frame, since they cannot be decoded without the lost one.
+	std::mutex _key_frame_waiting_mutex;
+	std::unordered_map<MediaTrackId, uint32_t> _key_frame_waiting_tracks;
+	std::atomic<size_t> _key_frame_waiting_track_count{0};
+	std::atomic<uint64_t> _trace_sample_count{0};
+
+	// Per-track state accessed by Pop() for every packet
+	struct TrackState
+	{
+		MediaTrackId track_id = 0;
+
+		// Temporary packet store. for calculating packet duration
+		std::shared_ptr<MediaPacket> stashed_packet;
+
+		// The last PTS (in milliseconds) to detect a sudden change in PTS
+		bool has_last_pts_ms = false;
+		int64_t last_pts_ms = 0;
+
+		// Statistics
+		int64_t stat_recv_pkt_lpts = 0;
+		int64_t stat_recv_pkt_ldts = 0;
+	};
+
+	// Returns the state of the track, and creates it if it does not exist
+	TrackState &GetTrackState(MediaTrackId track_id);
+
+	// A stream has only a few tracks, so a linear search over a contiguous array is faster than a tree lookup
+	std::vector<TrackState> _track_states;
 
 	// Time for statistics
 	ov::StopWatch _stop_watch;
@@ -120,22 +120,25 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 			return {AccessController::VerificationResult::Error, nullptr};
 		}
 
-		std::shared_ptr<AdmissionWebhooks> admission_webhooks;
+		auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url, request_info->GetNewUrl());
+		auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
+
+		// The result of the closing notification doesn't change anything, so the caller doesn't wait for the response
+		auto callback = [=](const std::shared_ptr<AdmissionWebhooks> &admission_webhooks) {
+			logti("AdmissionWebhooks notified %s that client %s closed %s. (Result : %s Elapsed : %u ms)",
+				control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(),
+				admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElapsedTime());
+		};
+
 		if(_provider_type != ProviderType::Unknown)
 		{
-			auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url, request_info->GetNewUrl());
-			auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
-
-			admission_webhooks = AdmissionWebhooks::Query(
-				_provider_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::CLOSING);
+			AdmissionWebhooks::QueryAsync(
+				_provider_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::CLOSING, 0, callback);
 		}
 		else if(_publisher_type != PublisherType::Unknown)
 		{
-			auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url, request_info->GetNewUrl());
-			auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
-
-			admission_webhooks = AdmissionWebhooks::Query(
-				_publisher_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::CLOSING);
+			AdmissionWebhooks::QueryAsync(
+				_publisher_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::CLOSING, 0, callback);
 		}
 		else
 		{
@@ -143,23 +146,7 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 			return {AccessController::VerificationResult::Error, nullptr};
 		}
 
-		if(admission_webhooks == nullptr)
-		{
-			// Probably this doesn't happen
-			logte("Could not load admission webhooks");
-			return {AccessController::VerificationResult::Error, nullptr};
-		}
-
-		logti("AdmissionWebhooks queried %s whether client %s could access %s. (Result : %s Elapsed : %u ms)",
-			control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(),
-			admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElapsedTime());
-
-		if(admission_webhooks->GetErrCode() != AdmissionWebhooks::ErrCode::ALLOWED)
-		{
-			return {AccessController::VerificationResult::Fail, admission_webhooks};
-		}
-
-		return {AccessController::VerificationResult::Pass, admission_webhooks};
+		return {AccessController::VerificationResult::Pass, nullptr};
 	}
 
 	// Probably this doesn't happen
@@ -219,6 +206,7 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		auto control_server_url = ov::Url::Parse(control_server_url_address);
 		auto secret_key = webhooks_config.GetSecretKey();
 		auto timeout_msec = webhooks_config.GetTimeoutMsec();
+		auto cache_ttl_msec = static_cast<uint32_t>(std::max(webhooks_config.GetCacheTTLMsec(), 0));
 
 		if(control_server_url == nullptr)
 		{
@@ -232,14 +220,14 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 			auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url);
 			auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
 
-			admission_webhooks = AdmissionWebhooks::Query(_provider_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info);
+			admission_webhooks = AdmissionWebhooks::Query(_provider_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::OPENING, cache_ttl_msec);
 		}
 		else if(_publisher_type != PublisherType::Unknown)
 		{
 			auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url);
 			auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
 
-			admission_webhooks = AdmissionWebhooks::Query(_publisher_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info);
+			admission_webhooks = AdmissionWebhooks::Query(_publisher_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::OPENING, cache_ttl_msec);
 		}
 		else
 		{
@@ -2,16 +2,19 @@
 
 #include <modules/http/client/http_client.h>
 
-std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
-															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
-															const ov::String secret_key,
-															const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
-															const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
-															const Status::Code status)
+#include "admission_webhooks_dispatcher.h"
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Create(ProviderType provider, PublisherType publisher,
+															 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															 const ov::String secret_key,
+															 const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+															 const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+															 const Status::Code status)
 {
 	auto hooks = std::make_shared<AdmissionWebhooks>();
 
 	hooks->_provider_type = provider;
+	hooks->_publisher_type = publisher;
 	hooks->_control_server_url = control_server_url;
 	hooks->_timeout_msec = timeout_msec;
 	hooks->_secret_key = secret_key;
@@ -19,31 +22,57 @@ std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provide
 	hooks->_client_info = client_info;
 	hooks->_status = status;
 
-	hooks->Run();
-
 	return hooks;
 }
 
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
+															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															const ov::String secret_key,
+															const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+															const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+															const Status::Code status, uint32_t cache_ttl_msec)
+{
+	auto hooks = Create(provider, PublisherType::Unknown, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
+
+	return AdmissionWebhooksDispatcher::GetInstance()->Query(hooks, cache_ttl_msec);
+}
+
 std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(PublisherType publisher,
 															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
 															const ov::String secret_key,
 															const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
 															const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
-															const Status::Code status)
+															const Status::Code status, uint32_t cache_ttl_msec)
 {
-	auto hooks = std::make_shared<AdmissionWebhooks>();
+	auto hooks = Create(ProviderType::Unknown, publisher, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
 
-	hooks->_publisher_type = publisher;
-	hooks->_control_server_url = control_server_url;
-	hooks->_timeout_msec = timeout_msec;
-	hooks->_secret_key = secret_key;
-	hooks->_request_info = request_info;
-	hooks->_client_info = client_info;
-	hooks->_status = status;
+	return AdmissionWebhooksDispatcher::GetInstance()->Query(hooks, cache_ttl_msec);
+}
 
-	hooks->Run();
+void AdmissionWebhooks::QueryAsync(ProviderType provider,
+								   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+								   const ov::String secret_key,
+								   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+								   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+								   const Status::Code status, uint32_t cache_ttl_msec,
+								   QueryCallback callback)
+{
+	auto hooks = Create(provider, PublisherType::Unknown, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
 
-	return hooks;
+	AdmissionWebhooksDispatcher::GetInstance()->QueryAsync(hooks, cache_ttl_msec, callback);
+}
+
+void AdmissionWebhooks::QueryAsync(PublisherType publisher,
+								   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+								   const ov::String secret_key,
+								   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+								   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+								   const Status::Code status, uint32_t cache_ttl_msec,
+								   QueryCallback callback)
+{
+	auto hooks = Create(ProviderType::Unknown, publisher, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
+
+	AdmissionWebhooksDispatcher::GetInstance()->QueryAsync(hooks, cache_ttl_msec, callback);
 }
 
 AdmissionWebhooks::ClientInfo::ClientInfo(const std::shared_ptr<ov::SocketAddress> &client_address)
@@ -300,6 +329,8 @@ void AdmissionWebhooks::Run()
 	client->SetMethod(http::Method::Post);
 	client->SetBlockingMode(ov::BlockingMode::Blocking);
 	client->SetConnectionTimeout(_timeout_msec);
+	// Reuse the connection to the control server
+	client->SetConnectionPool(AdmissionWebhooksDispatcher::GetInstance()->GetConnectionPool());
 	client->SetRequestHeader("X-OME-Signature", signature_sha1_base64);
 	client->SetRequestHeader("Content-Type", "application/json");
 	client->SetRequestHeader("Accept", "application/json");
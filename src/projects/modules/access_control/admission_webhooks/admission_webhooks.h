@@ -7,6 +7,8 @@
 class AdmissionWebhooks
 {
 public:
+	using QueryCallback = std::function<void(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks)>;
+
 	enum class ErrCode : uint8_t
 	{
 		// From control server
@@ -75,14 +77,35 @@ public:
 													const ov::String secret_key,
 													const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
 													const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
-													const Status::Code status = Status::Code::OPENING);
+													const Status::Code status = Status::Code::OPENING,
+													uint32_t cache_ttl_msec = 0);
 
 	static std::shared_ptr<AdmissionWebhooks> Query(PublisherType publisher,
 													const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
 													const ov::String secret_key,
 													const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
 													const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
-													const Status::Code status = Status::Code::OPENING);
+													const Status::Code status = Status::Code::OPENING,
+													uint32_t cache_ttl_msec = 0);
+
+	// The query is sent from another thread, and the callback is called with the result.
+	// An OPENING query is coalesced with the identical query in flight, and if cache_ttl_msec > 0,
+	// the decision of the control server is cached for cache_ttl_msec (but not longer than the lifetime)
+	static void QueryAsync(ProviderType provider,
+						   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+						   const ov::String secret_key,
+						   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+						   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+						   const Status::Code status, uint32_t cache_ttl_msec,
+						   QueryCallback callback);
+
+	static void QueryAsync(PublisherType publisher,
+						   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+						   const ov::String secret_key,
+						   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+						   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+						   const Status::Code status, uint32_t cache_ttl_msec,
+						   QueryCallback callback);
 
 	ErrCode GetErrCode() const;
 	ov::String GetErrReason() const;
@@ -91,6 +114,15 @@ public:
 	uint64_t GetElapsedTime() const;
 	
 private:
+	friend class AdmissionWebhooksDispatcher;
+
+	static std::shared_ptr<AdmissionWebhooks> Create(ProviderType provider, PublisherType publisher,
+													 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+													 const ov::String secret_key,
+													 const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+													 const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+													 const Status::Code status);
+
 	void Run();
 	ov::String GetMessageBody();
 	void SetError(ErrCode code, ov::String reason);
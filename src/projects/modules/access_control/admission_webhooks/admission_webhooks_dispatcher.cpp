@@ -0,0 +1,303 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "admission_webhooks_dispatcher.h"
+
+#include <pthread.h>
+
+#define OV_LOG_TAG "AdmissionWebhooks"
+
+AdmissionWebhooksDispatcher::AdmissionWebhooksDispatcher()
+	: _connection_pool(std::make_shared<http::clnt::HttpClientConnectionPool>())
+{
+	for (int index = 0; index < ADMISSION_WEBHOOKS_WORKER_COUNT; index++)
+	{
+		_workers.emplace_back(&AdmissionWebhooksDispatcher::WorkerThread, this);
+		::pthread_setname_np(_workers.back().native_handle(), "AdmWebhooks");
+	}
+}
+
+AdmissionWebhooksDispatcher::~AdmissionWebhooksDispatcher()
+{
+	_queue.Stop();
+
+	for (auto &worker : _workers)
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+
+	_connection_pool->Clear();
+}
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooksDispatcher::Query(const std::shared_ptr<AdmissionWebhooks> &query, uint32_t cache_ttl_msec)
+{
+	auto key = GetKey(query);
+
+	if ((key.IsEmpty() == false) && (cache_ttl_msec > 0))
+	{
+		auto cached = FindCachedDecision(key);
+		if (cached != nullptr)
+		{
+			return cached;
+		}
+	}
+
+	bool is_new;
+	auto in_flight_query = JoinInFlightQuery(query, cache_ttl_msec, key, &is_new);
+
+	if (is_new)
+	{
+		Run(in_flight_query);
+		return in_flight_query->result;
+	}
+
+	logtd("Waiting for the same query in flight: %s", key.CStr());
+
+	std::unique_lock<std::mutex> lock(in_flight_query->mutex);
+	in_flight_query->condition.wait(lock, [&]() -> bool {
+		return in_flight_query->completed;
+	});
+
+	return in_flight_query->result;
+}
+
+void AdmissionWebhooksDispatcher::QueryAsync(const std::shared_ptr<AdmissionWebhooks> &query, uint32_t cache_ttl_msec, QueryCallback callback)
+{
+	auto key = GetKey(query);
+
+	if ((key.IsEmpty() == false) && (cache_ttl_msec > 0))
+	{
+		auto cached = FindCachedDecision(key);
+		if (cached != nullptr)
+		{
+			if (callback != nullptr)
+			{
+				callback(cached);
+			}
+
+			return;
+		}
+	}
+
+	bool is_new;
+	auto in_flight_query = JoinInFlightQuery(query, cache_ttl_msec, key, &is_new);
+
+	if (callback != nullptr)
+	{
+		std::unique_lock<std::mutex> lock(in_flight_query->mutex);
+
+		if (in_flight_query->completed == false)
+		{
+			in_flight_query->callbacks.push_back(callback);
+		}
+		else
+		{
+			lock.unlock();
+			callback(in_flight_query->result);
+		}
+	}
+
+	if (is_new)
+	{
+		_queue.Enqueue(in_flight_query);
+	}
+}
+
+std::shared_ptr<http::clnt::HttpClientConnectionPool> AdmissionWebhooksDispatcher::GetConnectionPool() const
+{
+	return _connection_pool;
+}
+
+ov::String AdmissionWebhooksDispatcher::GetKey(const std::shared_ptr<AdmissionWebhooks> &query)
+{
+	if (query->_status != AdmissionWebhooks::Status::Code::OPENING)
+	{
+		// Every CLOSING notification is sent to the control server
+		return "";
+	}
+
+	auto new_url = query->_request_info->GetNewUrl();
+
+	// The port of the client and the time are not a part of the key, since they are not used to decide the admission
+	return ov::String::FormatString(
+		"%s|%s|%d|%d|%s|%s|%s|%s",
+		query->_control_server_url->ToUrlString(true).CStr(),
+		query->_secret_key.CStr(),
+		static_cast<int>(query->_provider_type),
+		static_cast<int>(query->_publisher_type),
+		query->_request_info->GetUrl()->ToUrlString(true).CStr(),
+		(new_url != nullptr) ? new_url->ToUrlString(true).CStr() : "",
+		(query->_client_info != nullptr) ? query->_client_info->GetAddress().CStr() : "",
+		(query->_client_info != nullptr) ? query->_client_info->GetUserAgent().CStr() : "");
+}
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooksDispatcher::FindCachedDecision(const ov::String &key)
+{
+	std::lock_guard<std::mutex> lock_guard(_cache_mutex);
+
+	auto item = _cache.find(key);
+	if (item == _cache.end())
+	{
+		return nullptr;
+	}
+
+	auto now_msec = static_cast<int64_t>(ov::Clock::NowMSec());
+	auto &cached_decision = item->second;
+
+	if (now_msec >= cached_decision.expire_msec)
+	{
+		_cache.erase(item);
+		return nullptr;
+	}
+
+	// The lifetime is counted from the time the control server decided
+	auto result = std::make_shared<AdmissionWebhooks>(*(cached_decision.result));
+	result->_elapsed_ms = 0;
+
+	if (result->_lifetime > 0)
+	{
+		result->_lifetime -= std::min<uint64_t>(result->_lifetime - 1, now_msec - cached_decision.cached_msec);
+	}
+
+	logtd("Cached decision is used: %s (remaining lifetime: %" PRIu64 " ms)", key.CStr(), result->_lifetime);
+
+	return result;
+}
+
+void AdmissionWebhooksDispatcher::CacheDecision(const ov::String &key, const std::shared_ptr<AdmissionWebhooks> &result, uint32_t cache_ttl_msec)
+{
+	auto err_code = result->GetErrCode();
+
+	if ((err_code != AdmissionWebhooks::ErrCode::ALLOWED) && (err_code != AdmissionWebhooks::ErrCode::DENIED))
+	{
+		// Failures are not cached, so the next query is sent to the control server again
+		return;
+	}
+
+	int64_t ttl_msec = cache_ttl_msec;
+
+	// A decision is not used beyond the lifetime given by the control server (0 means infinite)
+	if (result->_lifetime > 0)
+	{
+		ttl_msec = std::min<int64_t>(ttl_msec, result->_lifetime);
+	}
+
+	auto now_msec = static_cast<int64_t>(ov::Clock::NowMSec());
+
+	std::lock_guard<std::mutex> lock_guard(_cache_mutex);
+
+	if (_cache.size() >= ADMISSION_WEBHOOKS_MAX_CACHE_COUNT)
+	{
+		for (auto item = _cache.begin(); item != _cache.end();)
+		{
+			if (now_msec >= item->second.expire_msec)
+			{
+				item = _cache.erase(item);
+			}
+			else
+			{
+				++item;
+			}
+		}
+
+		if (_cache.size() >= ADMISSION_WEBHOOKS_MAX_CACHE_COUNT)
+		{
+			logtw("The decision cache is full (%zu items), the decision is not cached", _cache.size());
+			return;
+		}
+	}
+
+	_cache[key] = {result, now_msec, now_msec + ttl_msec};
+}
+
+std::shared_ptr<AdmissionWebhooksDispatcher::InFlightQuery> AdmissionWebhooksDispatcher::JoinInFlightQuery(const std::shared_ptr<AdmissionWebhooks> &query, uint32_t cache_ttl_msec, const ov::String &key, bool *is_new)
+{
+	auto in_flight_query = std::make_shared<InFlightQuery>();
+	in_flight_query->query = query;
+	in_flight_query->cache_ttl_msec = cache_ttl_msec;
+	in_flight_query->key = key;
+
+	*is_new = true;
+
+	if (key.IsEmpty())
+	{
+		return in_flight_query;
+	}
+
+	std::lock_guard<std::mutex> lock_guard(_in_flight_mutex);
+
+	auto item = _in_flight_queries.find(key);
+	if (item != _in_flight_queries.end())
+	{
+		*is_new = false;
+		return item->second;
+	}
+
+	_in_flight_queries[key] = in_flight_query;
+
+	return in_flight_query;
+}
+
+void AdmissionWebhooksDispatcher::Run(const std::shared_ptr<InFlightQuery> &in_flight_query)
+{
+	auto result = in_flight_query->query;
+
+	result->Run();
+
+	if (in_flight_query->key.IsEmpty() == false)
+	{
+		if (in_flight_query->cache_ttl_msec > 0)
+		{
+			// Cache the decision before the query leaves the in-flight map, so the next query finds either of them
+			CacheDecision(in_flight_query->key, result, in_flight_query->cache_ttl_msec);
+		}
+
+		std::lock_guard<std::mutex> lock_guard(_in_flight_mutex);
+		_in_flight_queries.erase(in_flight_query->key);
+	}
+
+	std::vector<QueryCallback> callbacks;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(in_flight_query->mutex);
+
+		in_flight_query->result = result;
+		in_flight_query->completed = true;
+		callbacks.swap(in_flight_query->callbacks);
+	}
+
+	in_flight_query->condition.notify_all();
+
+	for (auto &callback : callbacks)
+	{
+		callback(result);
+	}
+}
+
+void AdmissionWebhooksDispatcher::WorkerThread()
+{
+	while (true)
+	{
+		auto in_flight_query = _queue.Dequeue();
+
+		if (in_flight_query.has_value() == false)
+		{
+			if (_queue.IsStopped())
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		Run(in_flight_query.value());
+	}
+}
@@ -0,0 +1,89 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/http/client/http_client_connection_pool.h>
+
+#include <condition_variable>
+#include <thread>
+#include <unordered_map>
+
+#include "admission_webhooks.h"
+
+#define ADMISSION_WEBHOOKS_WORKER_COUNT 4
+#define ADMISSION_WEBHOOKS_MAX_CACHE_COUNT 10000
+
+// Sends the queries of AdmissionWebhooks to the control servers.
+//
+// - An OPENING query that is identical to a query in flight (the same control server, protocol, direction, url and client)
+//   doesn't send a request, but gets the result of the query in flight
+// - If the cache TTL is configured, ALLOWED/DENIED decisions are kept for the TTL (or the lifetime given by the control server, if shorter),
+//   and a cached decision is returned with the remaining lifetime
+// - The connections to the control servers are kept alive and reused
+class AdmissionWebhooksDispatcher : public ov::Singleton<AdmissionWebhooksDispatcher>
+{
+public:
+	using QueryCallback = std::function<void(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks)>;
+
+	AdmissionWebhooksDispatcher();
+	~AdmissionWebhooksDispatcher() override;
+
+	// Runs the query in the calling thread (or waits for the identical query in flight)
+	std::shared_ptr<AdmissionWebhooks> Query(const std::shared_ptr<AdmissionWebhooks> &query, uint32_t cache_ttl_msec);
+	// Runs the query in the worker threads, and the callback is called from a worker thread
+	// (or from the calling thread if the decision is cached)
+	void QueryAsync(const std::shared_ptr<AdmissionWebhooks> &query, uint32_t cache_ttl_msec, QueryCallback callback);
+
+	std::shared_ptr<http::clnt::HttpClientConnectionPool> GetConnectionPool() const;
+
+private:
+	struct InFlightQuery
+	{
+		std::shared_ptr<AdmissionWebhooks> query;
+		uint32_t cache_ttl_msec = 0;
+		// Empty if the query is not coalesced
+		ov::String key;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		bool completed = false;
+		std::shared_ptr<AdmissionWebhooks> result;
+		std::vector<QueryCallback> callbacks;
+	};
+
+	struct CachedDecision
+	{
+		std::shared_ptr<AdmissionWebhooks> result;
+		int64_t cached_msec = 0;
+		int64_t expire_msec = 0;
+	};
+
+	static ov::String GetKey(const std::shared_ptr<AdmissionWebhooks> &query);
+
+	std::shared_ptr<AdmissionWebhooks> FindCachedDecision(const ov::String &key);
+	void CacheDecision(const ov::String &key, const std::shared_ptr<AdmissionWebhooks> &result, uint32_t cache_ttl_msec);
+
+	// Returns the query in flight for the key. If there is no query in flight, registers a new one and sets is_new to true
+	std::shared_ptr<InFlightQuery> JoinInFlightQuery(const std::shared_ptr<AdmissionWebhooks> &query, uint32_t cache_ttl_msec, const ov::String &key, bool *is_new);
+	void Run(const std::shared_ptr<InFlightQuery> &in_flight_query);
+
+	void WorkerThread();
+
+	std::shared_ptr<http::clnt::HttpClientConnectionPool> _connection_pool;
+
+	std::mutex _in_flight_mutex;
+	std::unordered_map<ov::String, std::shared_ptr<InFlightQuery>> _in_flight_queries;
+
+	std::mutex _cache_mutex;
+	std::unordered_map<ov::String, CachedDecision> _cache;
+
+	ov::Queue<std::shared_ptr<InFlightQuery>> _queue{"AdmissionWebhooks", 500};
+	std::vector<std::thread> _workers;
+};
@@ -1,20 +1,38 @@
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <base/ovcrypto/base_64.h>
 #include <base/ovlibrary/converter.h>
 #include <base/ovcrypto/message_digest.h>
 
 #include "signed_policy.h"
+#include "signed_policy_cache.h"
 
 
 // requested_url ==> scheme://domain:port/app/stream[/file]?[query1=value&query2=value&]policy=value&signature=value
 std::shared_ptr<const SignedPolicy> SignedPolicy::Load(const ov::String &client_address, const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key)
 {
+	auto cache_key = SignedPolicyCache::MakeKey(requested_url, policy_query_key, signature_query_key, secret_key);
+	auto cached_policy = SignedPolicyCache::GetInstance()->Find(cache_key);
+
+	if (cached_policy != nullptr)
+	{
+		// The signature of the URL has been verified, and the policy has been parsed
+		if (cached_policy->IsPassed(client_address))
+		{
+			return cached_policy;
+		}
+
+		auto signed_policy = std::make_shared<SignedPolicy>(*cached_policy);
+		signed_policy->CheckPolicy(client_address);
+		return signed_policy;
+	}
+
 	auto signed_policy = std::make_shared<SignedPolicy>();
-	signed_policy->Process(client_address, requested_url, policy_query_key, signature_query_key, secret_key);
+	signed_policy->Process(client_address, requested_url, policy_query_key, signature_query_key, secret_key, cache_key);
 	return signed_policy;
 }
 
-bool SignedPolicy::Process(const ov::String &client_address, const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key)
+bool SignedPolicy::Process(const ov::String &client_address, const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key, const ov::String &cache_key)
 {
 	auto url = ov::Url::Parse(requested_url);
 	
@@ -51,9 +69,12 @@ bool SignedPolicy::Process(const ov::String &client_address, const ov::String &r
 		return false;
 	}
 
-	if(signature_base64 != signature_query_value)
+	// Compare in constant time, so the time taken doesn't tell how many leading characters of the signature are correct
+	if((signature_base64.GetLength() != signature_query_value.GetLength()) ||
+		(::CRYPTO_memcmp(signature_base64.CStr(), signature_query_value.CStr(), signature_base64.GetLength()) != 0))
 	{
-		SetError(ErrCode::INVALID_SIGNATURE, ov::String::FormatString("Signature value is invalid(expected : %s | input : %s).", signature_base64.CStr(), signature_query_value.CStr()));
+		// The expected signature must not be a part of the error message, since it may be sent to the client
+		SetError(ErrCode::INVALID_SIGNATURE, ov::String::FormatString("Signature value is invalid(input : %s).", signature_query_value.CStr()));
 		return false;
 	}
 
@@ -61,8 +82,45 @@ bool SignedPolicy::Process(const ov::String &client_address, const ov::String &r
 	auto policy_base64 = url->GetQueryValue(policy_query_key);
 	auto policy = ov::Base64::Decode(policy_base64, true);
 
-	if(ProcessPolicyJson(policy->ToString()) == false)
+	if((policy == nullptr) || (ProcessPolicyJson(policy->ToString()) == false))
+	{
+		if(policy == nullptr)
+		{
+			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The policy is not a valid base64 string."));
+		}
+
+		return false;
+	}
+
+	// The next requests with the same URL skip the steps above
+	auto verified_policy = std::make_shared<SignedPolicy>(*this);
+	verified_policy->SetError(ErrCode::PASSED, "Authorized");
+	SignedPolicyCache::GetInstance()->Add(cache_key, verified_policy);
+
+	return CheckPolicy(client_address);
+}
+
+bool SignedPolicy::CheckPolicy(const ov::String &client_address)
+{
+	auto now_msec = ov::Clock::NowMSec();
+
+	// Policy expired
+	if(_url_expire_epoch_msec < now_msec)
+	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("URL has expired.(now:%llu policy_expire:%llu) ", now_msec, _url_expire_epoch_msec));
+		return false;
+	}
+
+	// Policy is not activated yet
+	if(_url_activate_epoch_msec > now_msec)
+	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The URL has not yet been activated.(now:%llu policy_activate:%llu) ", now_msec, _url_activate_epoch_msec));
+		return false;
+	}
+
+	if((_stream_expire_epoch_msec > 0) && (_stream_expire_epoch_msec < now_msec))
 	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("Stream has expired.(now:%llu policy_expire:%llu) ", now_msec, _url_expire_epoch_msec));
 		return false;
 	}
 
@@ -78,6 +136,16 @@ bool SignedPolicy::Process(const ov::String &client_address, const ov::String &r
 	return true;
 }
 
+bool SignedPolicy::IsPassed(const ov::String &client_address) const
+{
+	auto now_msec = ov::Clock::NowMSec();
+
+	return (_url_expire_epoch_msec >= now_msec) &&
+		   (_url_activate_epoch_msec <= now_msec) &&
+		   ((_stream_expire_epoch_msec == 0) || (_stream_expire_epoch_msec >= now_msec)) &&
+		   IsAllowedIP(client_address);
+}
+
 bool SignedPolicy::MakeSignature(const ov::String &base_url, const ov::String &secret_key, ov::String &signature_base64)
 {
 	auto md = ov::MessageDigest::ComputeHmac(ov::CryptoAlgorithm::Sha1, secret_key.ToData(false), base_url.ToData(false));
@@ -121,35 +189,16 @@ bool SignedPolicy::ProcessPolicyJson(const ov::String &policy_json)
 	else
 	{
 		_url_expire_epoch_msec = jv_url_expire.asUInt64();
-
-		// Policy expired
-		if(_url_expire_epoch_msec < ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("URL has expired.(now:%llu policy_expire:%llu) ", ov::Clock::NowMSec(), _url_expire_epoch_msec));
-			return false;
-		}
 	}
 	
 	if(!jv_url_activate.isNull() && jv_url_activate.isUInt64())
 	{
 		_url_activate_epoch_msec = jv_url_activate.asUInt64();
-
-		// Policy is not activated yet
-		if(_url_activate_epoch_msec > ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The URL has not yet been activated.(now:%llu policy_activate:%llu) ", ov::Clock::NowMSec(), _url_activate_epoch_msec));
-			return false;
-		}
 	}
 
 	if(!jv_stream_expire.isNull() && jv_stream_expire.isUInt64())
 	{
 		_stream_expire_epoch_msec = jv_stream_expire.asUInt64();
-		if(_stream_expire_epoch_msec < ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("Stream has expired.(now:%llu policy_expire:%llu) ", ov::Clock::NowMSec(), _url_expire_epoch_msec));
-			return false;
-		}
 	}
 	
 	if(!jv_allow_ip.isNull() && jv_allow_ip.isString())
@@ -56,8 +56,12 @@ private:
 		_error_message = message;
 	}
 
-    bool Process(const ov::String &client_address, const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key);
+    bool Process(const ov::String &client_address, const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key, const ov::String &cache_key);
 	bool ProcessPolicyJson(const ov::String &policy_json);
+	// Checks the conditions of the policy that depend on the time and the client
+	bool CheckPolicy(const ov::String &client_address);
+	// Same as CheckPolicy(), but doesn't make the error
+	bool IsPassed(const ov::String &client_address) const;
 	bool MakeSignature(const ov::String &base_url, const ov::String &secret_key, ov::String &signature_base64);
 
 private:
@@ -0,0 +1,75 @@
+#include "signed_policy_cache.h"
+
+#include "signed_policy.h"
+
+ov::String SignedPolicyCache::MakeKey(const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key)
+{
+	// '\n' can't be a part of an URL
+	return ov::String::FormatString("%s\n%s\n%s\n%s", secret_key.CStr(), policy_query_key.CStr(), signature_query_key.CStr(), requested_url.CStr());
+}
+
+std::shared_ptr<const SignedPolicy> SignedPolicyCache::Find(const ov::String &key)
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+
+	auto item = _policies.find(key);
+	if (item == _policies.end())
+	{
+		return nullptr;
+	}
+
+	// An expired URL is never passed, so let it be verified again to make the same error
+	if (item->second->GetPolicyExpireEpochMSec() < ov::Clock::NowMSec())
+	{
+		return nullptr;
+	}
+
+	return item->second;
+}
+
+void SignedPolicyCache::Add(const ov::String &key, const std::shared_ptr<const SignedPolicy> &signed_policy)
+{
+	std::lock_guard<std::shared_mutex> lock(_mutex);
+
+	if (_policies.find(key) != _policies.end())
+	{
+		// Another thread has verified the same URL
+		return;
+	}
+
+	if (_policies.size() >= SIGNED_POLICY_CACHE_MAX_COUNT)
+	{
+		RemoveExpiredPolicies(ov::Clock::NowMSec());
+
+		while (_policies.size() >= SIGNED_POLICY_CACHE_MAX_COUNT)
+		{
+			_policies.erase(_keys.front());
+			_keys.pop_front();
+		}
+	}
+
+	_policies.emplace(key, signed_policy);
+	_keys.push_back(key);
+}
+
+void SignedPolicyCache::RemoveExpiredPolicies(uint64_t now_msec)
+{
+	for (auto key = _keys.begin(); key != _keys.end();)
+	{
+		auto item = _policies.find(*key);
+
+		if ((item == _policies.end()) || (item->second->GetPolicyExpireEpochMSec() < now_msec))
+		{
+			if (item != _policies.end())
+			{
+				_policies.erase(item);
+			}
+
+			key = _keys.erase(key);
+		}
+		else
+		{
+			++key;
+		}
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <shared_mutex>
+#include <unordered_map>
+
+#define SIGNED_POLICY_CACHE_MAX_COUNT 10000
+
+class SignedPolicy;
+
+// Keeps the SignedPolicies whose signature has been verified and whose policy has been parsed,
+// so the requests with the same URL (e.g. playlist requests of a player) don't decode and verify it again.
+//
+// Since the signature covers the whole URL, the key is the URL (including the policy and the signature)
+// and the secret key. The conditions that depend on the time and the client are checked for every request.
+class SignedPolicyCache : public ov::Singleton<SignedPolicyCache>
+{
+public:
+	static ov::String MakeKey(const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key);
+
+	std::shared_ptr<const SignedPolicy> Find(const ov::String &key);
+	void Add(const ov::String &key, const std::shared_ptr<const SignedPolicy> &signed_policy);
+
+private:
+	// Must be called with the exclusive lock
+	void RemoveExpiredPolicies(uint64_t now_msec);
+
+	std::shared_mutex _mutex;
+	std::unordered_map<ov::String, std::shared_ptr<const SignedPolicy>> _policies;
+	// The keys in the order they are added, the oldest one is removed first if the cache is full
+	std::deque<ov::String> _keys;
+};
@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "fmp4_dvr_cache.h"
+
+#include "fmp4_private.h"
+
+namespace bmff
+{
+	FMP4DvrCache::FMP4DvrCache(size_t capacity)
+		: _capacity(capacity)
+	{
+	}
+
+	std::shared_ptr<FMP4Segment> FMP4DvrCache::Get(const ov::String &stream_tag, int32_t track_id, uint32_t segment_number, bool *admitted)
+	{
+		Key key{stream_tag, track_id, segment_number};
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto it = _item_map.find(key);
+		if (it != _item_map.end())
+		{
+			// Move to the front
+			_items.splice(_items.begin(), _items, it->second);
+			return it->second->segment;
+		}
+
+		// The segment is requested again - load it into the cache
+		*admitted = (++_request_counts[key] >= 2);
+
+		return nullptr;
+	}
+
+	void FMP4DvrCache::Add(const ov::String &stream_tag, int32_t track_id, const std::shared_ptr<FMP4Segment> &segment)
+	{
+		auto segment_size = segment->GetData()->GetLength();
+
+		if (segment_size > _capacity)
+		{
+			return;
+		}
+
+		Key key{stream_tag, track_id, static_cast<uint32_t>(segment->GetNumber())};
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (_item_map.find(key) != _item_map.end())
+		{
+			// Another request has already loaded the segment
+			return;
+		}
+
+		_request_counts.erase(key);
+
+		// Evict the least recently used segments (of any stream)
+		while ((_cached_bytes + segment_size) > _capacity)
+		{
+			RemoveItem(std::prev(_items.end()));
+		}
+
+		_items.push_front({key, segment});
+		_item_map.emplace(key, _items.begin());
+		_cached_bytes += segment_size;
+	}
+
+	void FMP4DvrCache::Remove(const ov::String &stream_tag, int32_t track_id, uint32_t segment_number)
+	{
+		Key key{stream_tag, track_id, segment_number};
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_request_counts.erase(key);
+
+		auto it = _item_map.find(key);
+		if (it != _item_map.end())
+		{
+			RemoveItem(it->second);
+		}
+	}
+
+	void FMP4DvrCache::RemoveTrack(const ov::String &stream_tag, int32_t track_id)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (auto it = _request_counts.begin(); it != _request_counts.end();)
+		{
+			if ((it->first.track_id == track_id) && (it->first.stream_tag == stream_tag))
+			{
+				it = _request_counts.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		for (auto it = _items.begin(); it != _items.end();)
+		{
+			auto current = it++;
+
+			if ((current->key.track_id == track_id) && (current->key.stream_tag == stream_tag))
+			{
+				RemoveItem(current);
+			}
+		}
+	}
+
+	void FMP4DvrCache::RemoveItem(std::list<Item>::iterator item)
+	{
+		_cached_bytes -= item->segment->GetData()->GetLength();
+		_item_map.erase(item->key);
+		_items.erase(item);
+	}
+}  // namespace bmff
@@ -0,0 +1,78 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "fmp4_structure.h"
+
+namespace bmff
+{
+	// An LRU cache of the DVR segments loaded from the files, shared by all FMP4Storages of an application,
+	// so the size of the cache is bounded by one byte budget regardless of the number of streams and tracks.
+	//
+	// A DVR segment is cached when it is requested twice, so the segments that are requested once
+	// (e.g. a single viewer seeking) are served from the file without evicting the hot segments
+	class FMP4DvrCache
+	{
+	public:
+		explicit FMP4DvrCache(size_t capacity);
+
+		// Returns the cached segment, or nullptr if it is not cached.
+		// If it is not cached, <admitted> is set to true when the segment is requested enough to be cached
+		std::shared_ptr<FMP4Segment> Get(const ov::String &stream_tag, int32_t track_id, uint32_t segment_number, bool *admitted);
+		void Add(const ov::String &stream_tag, int32_t track_id, const std::shared_ptr<FMP4Segment> &segment);
+
+		void Remove(const ov::String &stream_tag, int32_t track_id, uint32_t segment_number);
+		// Removes all segments of the track (when the FMP4Storage is destroyed)
+		void RemoveTrack(const ov::String &stream_tag, int32_t track_id);
+
+	private:
+		struct Key
+		{
+			ov::String stream_tag;
+			int32_t track_id;
+			uint32_t segment_number;
+
+			bool operator==(const Key &other) const
+			{
+				return (segment_number == other.segment_number) && (track_id == other.track_id) && (stream_tag == other.stream_tag);
+			}
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(const Key &key) const
+			{
+				return std::hash<ov::String>()(key.stream_tag) ^ (static_cast<size_t>(key.track_id) << 32) ^ key.segment_number;
+			}
+		};
+
+		struct Item
+		{
+			Key key;
+			std::shared_ptr<FMP4Segment> segment;
+		};
+
+		// Must be called with _mutex
+		void RemoveItem(std::list<Item>::iterator item);
+
+		const size_t _capacity;
+
+		std::mutex _mutex;
+		// Most recently used segment is at the front
+		std::list<Item> _items;
+		std::unordered_map<Key, std::list<Item>::iterator, KeyHash> _item_map;
+		size_t _cached_bytes = 0;
+		// The number of requests of the segments that are not cached yet (for admission)
+		std::unordered_map<Key, uint32_t, KeyHash> _request_counts;
+	};
+}  // namespace bmff
@@ -37,6 +37,11 @@ namespace bmff
 	{
 		if (_config.dvr_enabled == true)
 		{
+			if (_config.dvr_cache != nullptr)
+			{
+				_config.dvr_cache->RemoveTrack(_stream_tag, _track->GetId());
+			}
+
 			// Delete all dvr directory and files
 			auto dvr_path = GetDVRDirectory();
 
@@ -55,27 +60,34 @@ namespace bmff
 
 	std::shared_ptr<FMP4Segment> FMP4Storage::GetMediaSegment(uint32_t segment_number) const
 	{
-		std::shared_lock<std::shared_mutex> lock(_segments_lock);
-		
-		if (_segments.empty())
-		{
-			return nullptr;
-		}
+		return GetMediaSegment(segment_number, nullptr);
+	}
 
-		auto it = _segments.find(segment_number);
-		if (it != _segments.end())
-		{
-			return it->second;
-		}
-		
-		auto min_number = _segments.begin()->first;
-		if (segment_number < min_number)
+	std::shared_ptr<FMP4Segment> FMP4Storage::GetMediaSegment(uint32_t segment_number, ov::String *dvr_file_path) const
+	{
 		{
-			// If the segment is not in the list, try to load it from the file
-			return LoadMediaSegmentFromFile(segment_number);
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
+
+			if (_segments.empty())
+			{
+				return nullptr;
+			}
+
+			auto it = _segments.find(segment_number);
+			if (it != _segments.end())
+			{
+				return it->second;
+			}
+
+			auto min_number = _segments.begin()->first;
+			if (segment_number >= min_number)
+			{
+				return nullptr;
+			}
 		}
 
-		return nullptr;
+		// If the segment is not in the list, try to get it from the DVR
+		return GetDvrSegment(segment_number, dvr_file_path);
 	}
 
 	std::shared_ptr<FMP4Segment> FMP4Storage::GetLastSegment() const
@@ -218,6 +230,9 @@ namespace bmff
 				break;
 			}
 
+			RemoveDvrSegment(segment_to_delete.segment_number);
+
+			// The file is still readable by the responses that have already opened it
 			auto file_path = GetSegmentFilePath(segment_to_delete.segment_number);
 			if (std::remove(file_path) != 0)
 			{
@@ -266,6 +281,53 @@ namespace bmff
 		return segment;
 	}
 
+	std::shared_ptr<FMP4Segment> FMP4Storage::GetDvrSegment(uint32_t segment_number, ov::String *dvr_file_path) const
+	{
+		if (_config.dvr_enabled == false)
+		{
+			return nullptr;
+		}
+
+		bool admitted = false;
+
+		if (_config.dvr_cache != nullptr)
+		{
+			auto segment = _config.dvr_cache->Get(_stream_tag, _track->GetId(), segment_number, &admitted);
+			if (segment != nullptr)
+			{
+				return segment;
+			}
+		}
+
+		if ((admitted == false) && (dvr_file_path != nullptr))
+		{
+			if (_dvr_info.GetSegmentInfo(segment_number).IsAvailable() == false)
+			{
+				return nullptr;
+			}
+
+			*dvr_file_path = GetSegmentFilePath(segment_number);
+			return nullptr;
+		}
+
+		auto segment = LoadMediaSegmentFromFile(segment_number);
+
+		if ((segment != nullptr) && admitted)
+		{
+			_config.dvr_cache->Add(_stream_tag, _track->GetId(), segment);
+		}
+
+		return segment;
+	}
+
+	void FMP4Storage::RemoveDvrSegment(uint32_t segment_number)
+	{
+		if (_config.dvr_cache != nullptr)
+		{
+			_config.dvr_cache->Remove(_stream_tag, _track->GetId(), segment_number);
+		}
+	}
+
 	bool FMP4Storage::AppendMediaChunk(const std::shared_ptr<ov::Data> &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool last_chunk)
 	{
 		auto segment = GetLastSegment();
@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "fmp4_dvr_cache.h"
 #include "fmp4_structure.h"
 
 namespace bmff
@@ -31,6 +32,8 @@ namespace bmff
 			bool dvr_enabled = false;
 			ov::String dvr_storage_path;
 			uint64_t dvr_duration_sec = 0;
+			// The cache of DVR segments shared by the storages of the application (nullptr: disabled)
+			std::shared_ptr<FMP4DvrCache> dvr_cache;
 			bool server_time_based_segment_numbering = false;
 		};
 
@@ -40,6 +43,9 @@ namespace bmff
 
 		std::shared_ptr<ov::Data> GetInitializationSection() const;
 		std::shared_ptr<FMP4Segment> GetMediaSegment(uint32_t segment_number) const;
+		// If the segment is a DVR segment that is not cached in memory, returns nullptr and sets <dvr_file_path>
+		// so the caller can send the file without loading it
+		std::shared_ptr<FMP4Segment> GetMediaSegment(uint32_t segment_number, ov::String *dvr_file_path) const;
 		std::shared_ptr<FMP4Segment> GetLastSegment() const;
 		std::shared_ptr<FMP4Chunk> GetMediaChunk(uint32_t segment_number, uint32_t chunk_number) const;
 
@@ -138,7 +144,7 @@ namespace bmff
 				}
 
 				// Check if the segment number is valid
-				if (_first_segment_number > segment_number)
+				if ((_first_segment_number > segment_number) || ((segment_number - _first_segment_number) >= _segments.size()))
 				{
 					return {0, 0, 0};
 				}
@@ -161,6 +167,10 @@ namespace bmff
 		bool SaveMediaSegmentToFile(const std::shared_ptr<FMP4Segment> &segment);
 		std::shared_ptr<FMP4Segment> LoadMediaSegmentFromFile(uint32_t segment_number) const;
 
+		// For DVR segment cache
+		std::shared_ptr<FMP4Segment> GetDvrSegment(uint32_t segment_number, ov::String *dvr_file_path) const;
+		void RemoveDvrSegment(uint32_t segment_number);
+
 		Config	_config;
 
 		std::shared_ptr<const MediaTrack> _track;
@@ -26,16 +26,23 @@ bool DtlsTransport::Stop()
 }
 
 // Set Local Certificate
-void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &certificate)
+void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &certificate, bool prefer_aes_gcm)
 {
 	_local_certificate = certificate;
 
+	// The server selects the first profile in this list that the peer also offers.
+	// AES-GCM is much cheaper than AES-CM + HMAC-SHA1 on CPUs with AES-NI/CLMUL,
+	// but AES-CM can be preferred for the peers/CPUs that GCM is slow.
+	const char *srtp_profiles = prefer_aes_gcm
+									? "SRTP_AEAD_AES_128_GCM:SRTP_AEAD_AES_256_GCM:SRTP_AES128_CM_SHA1_80:SRTP_AES128_CM_SHA1_32"
+									: "SRTP_AES128_CM_SHA1_80:SRTP_AES128_CM_SHA1_32:SRTP_AEAD_AES_128_GCM:SRTP_AEAD_AES_256_GCM";
+
 	ov::TlsContextCallback tls_context_callback = {
-		.create_callback = [](ov::TlsContext *tls_context, SSL_CTX *context) -> bool {
+		.create_callback = [srtp_profiles](ov::TlsContext *tls_context, SSL_CTX *context) -> bool {
 			tls_context->SetVerify(SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT);
 
 			// SSL_CTX_set_tlsext_use_srtp() returns 1 on error, 0 on success
-			if (::SSL_CTX_set_tlsext_use_srtp(context, "SRTP_AEAD_AES_128_GCM:SRTP_AES128_CM_SHA1_80:SRTP_AES128_CM_SHA1_32"))
+			if (::SSL_CTX_set_tlsext_use_srtp(context, srtp_profiles))
 			{
 				logte("SSL_CTX_set_tlsext_use_srtp failed");
 				return false;
@@ -159,6 +166,7 @@ bool DtlsTransport::MakeSrtpKey()
 	const ov::String label = "EXTRACTOR-dtls_srtp";
 
 	auto crypto_suite = _tls.GetSelectedSrtpProfileId();
+	logtd("Selected SRTP profile: %s", SrtpAdapter::GetCryptoSuiteName(crypto_suite));
 
 	std::shared_ptr<ov::Data> server_key = std::make_shared<ov::Data>();
 	std::shared_ptr<ov::Data> client_key = std::make_shared<ov::Data>();
@@ -20,7 +20,8 @@ public:
 	virtual ~DtlsTransport();
 
 	// Set Local Certificate
-	void SetLocalCertificate(const std::shared_ptr<Certificate> &certificate);
+	// If prefer_aes_gcm is true, AES-GCM SRTP profiles are selected when the peer offers them
+	void SetLocalCertificate(const std::shared_ptr<Certificate> &certificate, bool prefer_aes_gcm = true);
 
 	// Set Peer Fingerprint for verification
 	void SetPeerFingerprint(ov::String algorithm, ov::String fingerprint);
@@ -13,6 +13,15 @@
 
 #define OV_LOG_TAG "SRTP"
 
+namespace
+{
+	// Returns the elapsed time from start_time in nanoseconds
+	uint64_t GetElapsedNanoseconds(const std::chrono::steady_clock::time_point &start_time)
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time).count();
+	}
+}  // namespace
+
 SrtpAdapter::SrtpAdapter()
 {
 	_session = nullptr;
@@ -54,6 +63,10 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 			srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtp);
 			srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtcp);
 			break;
+		case SRTP_AEAD_AES_256_GCM:
+			srtp_crypto_policy_set_aes_gcm_256_16_auth(&policy.rtp);
+			srtp_crypto_policy_set_aes_gcm_256_16_auth(&policy.rtcp);
+			break;
 		default:
 			logte("Failed to create srtp adapter. Unsupported crypto suite %d", crypto_suite);
 			return false;
@@ -79,7 +92,9 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 	_rtp_auth_tag_len = policy.rtp.auth_tag_len;
     _rtcp_auth_tag_len = policy.rtcp.auth_tag_len;
 
-    logtd("srtp teg size rtp(%d) rtcp(%d)", _rtp_auth_tag_len, _rtcp_auth_tag_len);
+	_statistics.crypto_suite = crypto_suite;
+
+    logtd("srtp suite(%s) teg size rtp(%d) rtcp(%d)", GetCryptoSuiteName(crypto_suite), _rtp_auth_tag_len, _rtcp_auth_tag_len);
 
 
 	return true;
@@ -111,13 +126,18 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 	uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
 
 	std::lock_guard<std::mutex> lock(_session_lock);
+	auto start_time = std::chrono::steady_clock::now();
 	int err = srtp_protect(_session, buffer, &out_len);
+	_statistics.protect_time_ns += GetElapsedNanoseconds(start_time);
 	if(err != srtp_err_status_ok)
 	{
 		logte("Failed to protect SRTP packet, err=%d, len=%d, seq=%u, payload_type=%d, red_payload_type=%d", err, out_len, seq, payload_type, red_payload_type);
 		return false;
 	}
 
+	_statistics.protect_count++;
+	_statistics.protect_bytes += out_len;
+
 	return true;
 }
 
@@ -142,13 +162,18 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
     data->SetLength(need_len);
 
 	std::lock_guard<std::mutex> lock(_session_lock);
+	auto start_time = std::chrono::steady_clock::now();
     int err = srtp_protect_rtcp(_session, buffer, &out_len);
+	_statistics.protect_time_ns += GetElapsedNanoseconds(start_time);
     if(err != srtp_err_status_ok)
     {
         logte("Failed to protect SRTCP packet, err=%d, len=%d", err, out_len);
         return false;
     }
 
+	_statistics.protect_count++;
+	_statistics.protect_bytes += out_len;
+
     return true;
 }
 
@@ -163,7 +188,10 @@ bool SrtpAdapter::UnprotectRtp(const std::shared_ptr<ov::Data> &data)
     int out_len = static_cast<int>(data->GetLength());
 
 	std::lock_guard<std::mutex> lock(_session_lock);
+	auto start_time = std::chrono::steady_clock::now();
     int err = srtp_unprotect(_session, buffer, &out_len);
+	_statistics.unprotect_time_ns += GetElapsedNanoseconds(start_time);
+	_statistics.unprotect_count++;
     if (err != srtp_err_status_ok)
     {
         logte("Failed to unprotect SRTP packet, err=%d", err);
@@ -186,7 +214,10 @@ bool SrtpAdapter::UnprotectRtcp(const std::shared_ptr<ov::Data> &data)
     int out_len = static_cast<int>(data->GetLength());
 
 	std::lock_guard<std::mutex> lock(_session_lock);
+	auto start_time = std::chrono::steady_clock::now();
     int err = srtp_unprotect_rtcp(_session, buffer, &out_len);
+	_statistics.unprotect_time_ns += GetElapsedNanoseconds(start_time);
+	_statistics.unprotect_count++;
     if (err != srtp_err_status_ok)
     {
         logte("Failed to unprotect SRTCP packet, err=%d", err);
@@ -197,3 +228,27 @@ bool SrtpAdapter::UnprotectRtcp(const std::shared_ptr<ov::Data> &data)
 
     return true;
 }
+
+SrtpStatistics SrtpAdapter::GetStatistics()
+{
+	std::lock_guard<std::mutex> lock(_session_lock);
+
+	return _statistics;
+}
+
+const char *SrtpAdapter::GetCryptoSuiteName(uint64_t crypto_suite)
+{
+	switch (crypto_suite)
+	{
+		case SRTP_AES128_CM_SHA1_80:
+			return "AES_CM_128_HMAC_SHA1_80";
+		case SRTP_AES128_CM_SHA1_32:
+			return "AES_CM_128_HMAC_SHA1_32";
+		case SRTP_AEAD_AES_128_GCM:
+			return "AEAD_AES_128_GCM";
+		case SRTP_AEAD_AES_256_GCM:
+			return "AEAD_AES_256_GCM";
+	}
+
+	return "Unknown";
+}
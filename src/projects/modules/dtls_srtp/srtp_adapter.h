@@ -13,6 +13,20 @@
 
 #include <srtp2/srtp.h>
 
+struct SrtpStatistics
+{
+	uint64_t crypto_suite = 0;
+
+	uint64_t protect_count = 0;
+	uint64_t protect_bytes = 0;
+	// Total time spent in srtp_protect()/srtp_protect_rtcp()
+	uint64_t protect_time_ns = 0;
+
+	uint64_t unprotect_count = 0;
+	// Total time spent in srtp_unprotect()/srtp_unprotect_rtcp()
+	uint64_t unprotect_time_ns = 0;
+};
+
 class SrtpAdapter
 {
 public:
@@ -26,10 +40,17 @@ public:
 	bool	UnprotectRtp(const std::shared_ptr<ov::Data> &data);
     bool	UnprotectRtcp(const std::shared_ptr<ov::Data> &data);
 
+	SrtpStatistics	GetStatistics();
+
+	static const char *GetCryptoSuiteName(uint64_t crypto_suite);
+
 private:
 	std::mutex		_session_lock;
 	srtp_ctx_t_* 	_session;
 	
 	uint32_t 		_rtp_auth_tag_len;
     uint32_t 		_rtcp_auth_tag_len;
+
+	// Protected by _session_lock
+	SrtpStatistics	_statistics;
 };
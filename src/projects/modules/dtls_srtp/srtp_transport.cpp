@@ -161,4 +161,16 @@ bool SrtpTransport::SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Da
 	}
 
 	return true;
-}
\ No newline at end of file
+}
+
+SrtpStatistics SrtpTransport::GetSendStatistics() const
+{
+	auto send_session = _send_session;
+
+	if(send_session == nullptr)
+	{
+		return SrtpStatistics();
+	}
+
+	return send_session->GetStatistics();
+}
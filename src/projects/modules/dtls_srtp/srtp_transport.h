@@ -27,6 +27,9 @@ public:
 
 	bool SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key);
 
+	// Returns the statistics of protecting outgoing packets (empty if the key material has not been set yet)
+	SrtpStatistics GetSendStatistics() const;
+
 private:
 	std::shared_ptr<SrtpAdapter>		_send_session = nullptr;
 	std::shared_ptr<SrtpAdapter>		_recv_session = nullptr;
@@ -67,6 +67,11 @@ namespace http
 			return _recv_timeout_msec;
 		}
 
+		void HttpClient::SetConnectionPool(const std::shared_ptr<HttpClientConnectionPool> &connection_pool)
+		{
+			_connection_pool = connection_pool;
+		}
+
 		void HttpClient::SetMethod(http::Method method)
 		{
 			_method = method;
@@ -248,12 +253,48 @@ namespace http
 				parsed_url->SetPort(port);
 			}
 
-			auto host_port_string = ov::String::FormatString("%s:%d", parsed_url->Host().CStr(), port);
+			_url = url;
+			_parsed_url = parsed_url;
+
+			_request_header["Host"] =
+				use_default_port
+					? ov::String::FormatString("%s", _parsed_url->Host().CStr())
+					: ov::String::FormatString("%s:%d", _parsed_url->Host().CStr(), _parsed_url->Port());
+
+			if ((_connection_pool != nullptr) && (_blocking_mode == ov::BlockingMode::Blocking))
+			{
+				_connection_key = HttpClientConnectionPool::GetKey(_parsed_url);
+
+				auto connection = _connection_pool->Pop(_connection_key);
+
+				if (connection.has_value())
+				{
+					// No need to resolve the address and connect to the server
+					_socket = connection->socket;
+					_tls_data = connection->tls_data;
+
+					if (_tls_data != nullptr)
+					{
+						_tls_data->SetIoCallback(GetSharedPtrAs<ov::TlsClientDataIoCallback>());
+					}
+
+					_is_reused_connection = true;
+
+					return nullptr;
+				}
+			}
+
+			return PrepareConnection(is_https, address);
+		}
+
+		std::shared_ptr<const ov::Error> HttpClient::PrepareConnection(bool is_https, ov::SocketAddress *address)
+		{
+			auto host_port_string = ov::String::FormatString("%s:%u", _parsed_url->Host().CStr(), _parsed_url->Port());
 			auto socket_address = ov::SocketAddress::CreateAndGetFirst(host_port_string);
 
 			if (socket_address.IsValid() == false)
 			{
-				return ov::Error::CreateError("HTTP", "Invalid address: %s, URL: %s", host_port_string.CStr(), url.CStr());
+				return ov::Error::CreateError("HTTP", "Invalid address: %s, URL: %s", host_port_string.CStr(), _url.CStr());
 			}
 
 			_socket = _socket_pool->AllocSocket(socket_address.GetFamily());
@@ -293,15 +334,77 @@ namespace http
 				*address = socket_address;
 			}
 
-			_url = url;
-			_parsed_url = parsed_url;
+			return nullptr;
+		}
 
-			_request_header["Host"] =
-				use_default_port
-					? ov::String::FormatString("%s", _parsed_url->Host().CStr())
-					: ov::String::FormatString("%s:%d", _parsed_url->Host().CStr(), _parsed_url->Port());
+		void HttpClient::Connect(const ov::SocketAddress &address)
+		{
+			// Convert milliseconds to timeval
+			_socket->SetRecvTimeout(
+				{.tv_sec = _recv_timeout_msec / 1000,
+				 .tv_usec = _recv_timeout_msec % 1000});
 
-			return nullptr;
+			if (_is_reused_connection)
+			{
+				OnConnected(nullptr);
+				return;
+			}
+
+			auto error = _socket->Connect(address, _connection_timeout_msec);
+
+			if (error == nullptr)
+			{
+				if (_socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
+				{
+					// Data will be downloaded in OnReadable()
+					return;
+				}
+
+				OnConnected(nullptr);
+				return;
+			}
+
+			HandleError(ov::Error::CreateError("HTTP", error->GetCode(), "Could not connect to %s: %s", _url.CStr(), error->GetMessage().CStr()));
+		}
+
+		void HttpClient::RetryWithNewConnection()
+		{
+			logtd("The reused connection was closed by the server, retrying with a new connection: %s", _url.CStr());
+
+			OV_SAFE_RESET(
+				_tls_data, nullptr, {
+					_tls_data->SetIoCallback(nullptr);
+					_tls_data = nullptr;
+				},
+				_tls_data);
+			OV_SAFE_RESET(_socket, nullptr, _socket->Close(), _socket);
+
+			_is_reused_connection = false;
+			_requested = false;
+
+			ov::SocketAddress address;
+			auto error = PrepareConnection(_parsed_url->Scheme().UpperCaseString() == "HTTPS", &address);
+
+			if (error != nullptr)
+			{
+				HandleError(error);
+				return;
+			}
+
+			Connect(address);
+		}
+
+		void HttpClient::ReleaseConnection()
+		{
+			if (_tls_data != nullptr)
+			{
+				_tls_data->SetIoCallback(nullptr);
+			}
+
+			_connection_pool->Push(_connection_key, {_socket, _tls_data});
+
+			_tls_data = nullptr;
+			_socket = nullptr;
 		}
 
 		void HttpClient::SendRequestIfNeeded()
@@ -381,28 +484,17 @@ namespace http
 				OV_ASSERT2(_url.IsEmpty() == false);
 				OV_ASSERT2(_parsed_url != nullptr);
 
-				logtd("Request an URL: %s (address: %s)...", url.CStr(), address.ToString(false).CStr());
-
-				// Convert milliseconds to timeval
-				_socket->SetRecvTimeout(
-					{.tv_sec = _recv_timeout_msec / 1000,
-					 .tv_usec = _recv_timeout_msec % 1000});
-
-				error = _socket->Connect(address, _connection_timeout_msec);
-
-				if (error == nullptr)
+				if (_is_reused_connection)
 				{
-					if (_socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
-					{
-						// Data will be downloaded in OnReadable()
-						return;
-					}
-
-					OnConnected(nullptr);
-					return;
+					logtd("Request an URL: %s (reuse: %s)...", url.CStr(), _socket->ToString().CStr());
+				}
+				else
+				{
+					logtd("Request an URL: %s (address: %s)...", url.CStr(), address.ToString(false).CStr());
 				}
 
-				error = ov::Error::CreateError("HTTP", error->GetCode(), "Could not connect to %s: %s", url.CStr(), error->GetMessage().CStr());
+				Connect(address);
+				return;
 			}
 
 			HandleError(error);
@@ -503,6 +595,21 @@ namespace http
 				}
 			}
 
+			if (_is_reused_connection && (_response_received == false) && ((error != nullptr) || need_to_callback))
+			{
+				// The server closed the idle connection before the request arrived
+				RetryWithNewConnection();
+				return;
+			}
+
+			// The connection can be reused only if the end of the response is determined by its length
+			bool is_reusable =
+				(_connection_pool != nullptr) &&
+				(error == nullptr) && (need_to_callback == false) &&
+				(_is_chunked_transfer || (_response_body->GetLength() == _parser.GetContentLength())) &&
+				(_parser.GetHttpVersionAsNumber() >= 1.1) &&
+				(_parser.GetHeader("Connection").LowerCaseString() != "close");
+
 			auto response_handler = _response_handler;
 
 			if (response_handler != nullptr)
@@ -510,6 +617,11 @@ namespace http
 				response_handler(_parser.GetStatusCode(), _response_body, error);
 			}
 
+			if (is_reusable)
+			{
+				ReleaseConnection();
+			}
+
 			CleanupVariables();
 		}
 
@@ -657,6 +769,11 @@ namespace http
 			auto remained = data->GetLength();
 			auto sub_data = data;
 
+			if (remained > 0)
+			{
+				_response_received = true;
+			}
+
 			while (remained > 0)
 			{
 				switch (_parser.GetStatus())
@@ -761,6 +878,9 @@ namespace http
 			_url.Clear();
 			_parsed_url = nullptr;
 			_response_handler = nullptr;
+			_connection_key.Clear();
+			_is_reused_connection = false;
+			_response_received = false;
 
 			OV_SAFE_RESET(
 				_tls_data, nullptr, {
@@ -16,6 +16,7 @@
 #include "../http_datastructure.h"
 #include "../http_error.h"
 #include "../protocol/http1/http_response_parser.h"
+#include "./http_client_connection_pool.h"
 
 namespace http
 {
@@ -47,6 +48,10 @@ namespace http
 
 			void SetTimeout(int timeout_msec);
 
+			// Reuses the connections of the previous requests to the same server (blocking mode only).
+			// If the server closes the reused connection before responding, the request is sent again with a new connection.
+			void SetConnectionPool(const std::shared_ptr<HttpClientConnectionPool> &connection_pool);
+
 			void SetMethod(http::Method method);
 			http::Method GetMethod() const;
 
@@ -107,6 +112,12 @@ namespace http
 
 		protected:
 			std::shared_ptr<const ov::Error> PrepareForRequest(const ov::String &url, ov::SocketAddress *address);
+			// Allocates a new socket (and TLS data) for _parsed_url
+			std::shared_ptr<const ov::Error> PrepareConnection(bool is_https, ov::SocketAddress *address);
+			void Connect(const ov::SocketAddress &address);
+			void RetryWithNewConnection();
+			// Returns the socket to the connection pool instead of closing it
+			void ReleaseConnection();
 			std::shared_ptr<const ov::OpensslError> TryTlsConnect();
 			void SendRequestIfNeeded();
 			// Use this API when blocking mode
@@ -151,6 +162,13 @@ namespace http
 
 			std::shared_ptr<ov::Socket> _socket;
 
+			std::shared_ptr<HttpClientConnectionPool> _connection_pool;
+			ov::String _connection_key;
+			// Whether _socket is taken from _connection_pool
+			bool _is_reused_connection = false;
+			// Whether any byte of the response is received
+			bool _response_received = false;
+
 			std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _request_header;
 			std::shared_ptr<ov::Data> _request_body;
 
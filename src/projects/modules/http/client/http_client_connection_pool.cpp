@@ -0,0 +1,209 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http_client_connection_pool.h"
+
+#include <sys/socket.h>
+
+#include "./http_client_private.h"
+
+namespace http
+{
+	namespace clnt
+	{
+		HttpClientConnectionPool::HttpClientConnectionPool(int idle_timeout_msec, size_t max_idle_per_host)
+			: _idle_timeout_msec(idle_timeout_msec),
+			  _max_idle_per_host(std::max<size_t>(max_idle_per_host, 1))
+		{
+		}
+
+		HttpClientConnectionPool::~HttpClientConnectionPool()
+		{
+			Clear();
+		}
+
+		ov::String HttpClientConnectionPool::GetKey(const std::shared_ptr<const ov::Url> &url)
+		{
+			return ov::String::FormatString("%s://%s:%u", url->Scheme().LowerCaseString().CStr(), url->Host().LowerCaseString().CStr(), url->Port());
+		}
+
+		std::optional<HttpClientConnectionPool::Connection> HttpClientConnectionPool::Pop(const ov::String &key)
+		{
+			std::vector<Connection> dead_connections;
+			std::optional<Connection> found;
+
+			{
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+
+				RemoveExpiredConnections(ov::Clock::NowMSec());
+
+				auto item = _idle_connections.find(key);
+				if (item != _idle_connections.end())
+				{
+					auto &connections = item->second;
+
+					while (connections.empty() == false)
+					{
+						auto connection = std::move(connections.back().connection);
+						connections.pop_back();
+
+						if (IsAlive(connection))
+						{
+							found = std::move(connection);
+							break;
+						}
+
+						dead_connections.push_back(std::move(connection));
+					}
+
+					if (connections.empty())
+					{
+						_idle_connections.erase(item);
+					}
+				}
+			}
+
+			for (auto &connection : dead_connections)
+			{
+				logtd("An idle connection was closed by the server: %s", connection.socket->ToString().CStr());
+				CloseConnection(connection);
+			}
+
+			return found;
+		}
+
+		void HttpClientConnectionPool::Push(const ov::String &key, const Connection &connection)
+		{
+			if (connection.socket == nullptr)
+			{
+				return;
+			}
+
+			std::vector<Connection> evicted_connections;
+
+			{
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+
+				auto now_msec = static_cast<int64_t>(ov::Clock::NowMSec());
+				RemoveExpiredConnections(now_msec);
+
+				auto &connections = _idle_connections[key];
+
+				if (connections.size() >= _max_idle_per_host)
+				{
+					// Close the least recently used connection
+					evicted_connections.push_back(std::move(connections.front().connection));
+					connections.pop_front();
+				}
+
+				connections.push_back({connection, now_msec});
+			}
+
+			for (auto &evicted_connection : evicted_connections)
+			{
+				CloseConnection(evicted_connection);
+			}
+		}
+
+		void HttpClientConnectionPool::Clear()
+		{
+			decltype(_idle_connections) idle_connections;
+
+			{
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+				idle_connections.swap(_idle_connections);
+			}
+
+			for (auto &item : idle_connections)
+			{
+				for (auto &idle_connection : item.second)
+				{
+					CloseConnection(idle_connection.connection);
+				}
+			}
+		}
+
+		size_t HttpClientConnectionPool::GetIdleCount() const
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			size_t count = 0;
+
+			for (auto &item : _idle_connections)
+			{
+				count += item.second.size();
+			}
+
+			return count;
+		}
+
+		bool HttpClientConnectionPool::IsAlive(const Connection &connection)
+		{
+			auto &socket = connection.socket;
+
+			if ((socket == nullptr) || (socket->GetState() != ov::SocketState::Connected))
+			{
+				return false;
+			}
+
+			char buffer;
+			auto result = ::recv(socket->GetNativeHandle(), &buffer, sizeof(buffer), MSG_PEEK | MSG_DONTWAIT);
+
+			if (result == 0)
+			{
+				// The server closed the connection
+				return false;
+			}
+
+			if (result > 0)
+			{
+				// A plain HTTP server must not send anything before a request, but a TLS server may send records such as
+				// session tickets, which are handled by the TLS layer
+				return (connection.tls_data != nullptr);
+			}
+
+			return ((errno == EAGAIN) || (errno == EWOULDBLOCK));
+		}
+
+		void HttpClientConnectionPool::CloseConnection(const Connection &connection)
+		{
+			if (connection.tls_data != nullptr)
+			{
+				connection.tls_data->SetIoCallback(nullptr);
+			}
+
+			if (connection.socket != nullptr)
+			{
+				connection.socket->Close();
+			}
+		}
+
+		void HttpClientConnectionPool::RemoveExpiredConnections(int64_t now_msec)
+		{
+			for (auto item = _idle_connections.begin(); item != _idle_connections.end();)
+			{
+				auto &connections = item->second;
+
+				while ((connections.empty() == false) && ((now_msec - connections.front().idle_since_msec) >= _idle_timeout_msec))
+				{
+					CloseConnection(connections.front().connection);
+					connections.pop_front();
+				}
+
+				if (connections.empty())
+				{
+					item = _idle_connections.erase(item);
+				}
+				else
+				{
+					++item;
+				}
+			}
+		}
+	}  // namespace clnt
+}  // namespace http
@@ -0,0 +1,78 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/ovcrypto.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/ovsocket.h>
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+// Idle connections are closed after this time (most HTTP servers close idle connections after 5~60 seconds)
+#define HTTP_CLIENT_CONNECTION_POOL_DEFAULT_IDLE_TIMEOUT_MSEC (4 * 1000)
+#define HTTP_CLIENT_CONNECTION_POOL_DEFAULT_MAX_IDLE_PER_HOST 16
+
+namespace http
+{
+	namespace clnt
+	{
+		// Keeps the connections of the completed requests to reuse them for the next requests to the same server.
+		// Only the connections of blocking-mode HttpClients are pooled, since the callback of
+		// a nonblocking socket can't be changed after the socket is created.
+		class HttpClientConnectionPool
+		{
+		public:
+			struct Connection
+			{
+				std::shared_ptr<ov::Socket> socket;
+				// nullptr if the connection is not HTTPS
+				std::shared_ptr<ov::TlsClientData> tls_data;
+			};
+
+			HttpClientConnectionPool(int idle_timeout_msec = HTTP_CLIENT_CONNECTION_POOL_DEFAULT_IDLE_TIMEOUT_MSEC,
+									 size_t max_idle_per_host = HTTP_CLIENT_CONNECTION_POOL_DEFAULT_MAX_IDLE_PER_HOST);
+			~HttpClientConnectionPool();
+
+			// key: "<scheme>://<host>:<port>"
+			static ov::String GetKey(const std::shared_ptr<const ov::Url> &url);
+
+			// Returns an idle connection that is still alive, or std::nullopt if there is no connection to reuse
+			std::optional<Connection> Pop(const ov::String &key);
+			// Returns the connection that has received the whole response, so no more data is pending
+			void Push(const ov::String &key, const Connection &connection);
+
+			// Closes all the idle connections
+			void Clear();
+
+			size_t GetIdleCount() const;
+
+		protected:
+			struct IdleConnection
+			{
+				Connection connection;
+				int64_t idle_since_msec = 0;
+			};
+
+			static bool IsAlive(const Connection &connection);
+			static void CloseConnection(const Connection &connection);
+
+			// Must be called with _mutex
+			void RemoveExpiredConnections(int64_t now_msec);
+
+			const int _idle_timeout_msec;
+			const size_t _max_idle_per_host;
+
+			mutable std::mutex _mutex;
+			// The most recently used connection is at the back
+			std::unordered_map<ov::String, std::deque<IdleConnection>> _idle_connections;
+		};
+	}  // namespace clnt
+}  // namespace http
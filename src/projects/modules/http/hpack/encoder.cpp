@@ -22,6 +22,7 @@ namespace http
 			}
 
 			_need_signal_table_size_update = true;
+			_table_version++;
 			return true;
 		}
 
@@ -77,6 +78,108 @@ namespace http
 			return encoded_data;
 		}
 
+		bool Encoder::IsVolatileHeaderField(const ov::String &name)
+		{
+			// Indexing these fields only evicts the other fields from the dynamic table
+			return (name == "content-length") ||
+				   (name == "content-range") ||
+				   (name == "date") ||
+				   (name == "last-modified") ||
+				   (name == "etag") ||
+				   (name == "age") ||
+				   (name == "expires");
+		}
+
+		std::shared_ptr<ov::Data> Encoder::EncodeHeaderBlock(const std::vector<HeaderField> &header_fields)
+		{
+			auto header_block = std::make_shared<ov::Data>(4096);
+			ov::ByteStream stream(header_block.get());
+
+			// The dynamic table size update must be at the beginning of the header block
+			if (_need_signal_table_size_update)
+			{
+				if (EncodeDynamicTableSizeUpdate(stream, _table_connector.GetDynamicTableSize()) == false)
+				{
+					logte("Failed to encode DynamicTableSizeUpdate (%u) field", _table_connector.GetDynamicTableSize());
+					return nullptr;
+				}
+
+				_need_signal_table_size_update = false;
+			}
+
+			ov::String cache_key;
+			std::vector<const HeaderField *> volatile_fields;
+
+			for (const auto &header_field : header_fields)
+			{
+				if (IsVolatileHeaderField(header_field.GetName()))
+				{
+					volatile_fields.push_back(&header_field);
+					continue;
+				}
+
+				// Field values can't contain CRLF
+				cache_key.Append(header_field.GetName());
+				cache_key.Append(": ");
+				cache_key.Append(header_field.GetValue());
+				cache_key.Append("\r\n");
+			}
+
+			auto cache_it = _header_block_cache.find(cache_key);
+			if ((cache_it != _header_block_cache.end()) && (cache_it->second.table_version == _table_version))
+			{
+				stream.Write(cache_it->second.block);
+			}
+			else
+			{
+				auto table_version = _table_version;
+				auto cached_block = std::make_shared<ov::Data>(4096);
+
+				for (const auto &header_field : header_fields)
+				{
+					if (IsVolatileHeaderField(header_field.GetName()))
+					{
+						continue;
+					}
+
+					auto encoded_field = Encode(header_field, EncodingType::LiteralWithIndexing);
+					if (encoded_field == nullptr)
+					{
+						return nullptr;
+					}
+
+					cached_block->Append(encoded_field);
+				}
+
+				stream.Write(cached_block);
+
+				// If some fields are indexed by this block, sending it again would index them again in the decoder.
+				// Such a block will be cached the next time, when all of the fields are found in the table.
+				if (table_version == _table_version)
+				{
+					if (_header_block_cache.size() >= HPACK_HEADER_BLOCK_CACHE_SIZE)
+					{
+						_header_block_cache.clear();
+					}
+
+					_header_block_cache[cache_key] = {table_version, cached_block};
+				}
+			}
+
+			for (const auto &header_field : volatile_fields)
+			{
+				auto encoded_field = Encode(*header_field, EncodingType::LiteralWithoutIndexing);
+				if (encoded_field == nullptr)
+				{
+					return nullptr;
+				}
+
+				stream.Write(encoded_field);
+			}
+
+			return header_block;
+		}
+
 		bool Encoder::EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index)
 		{
 			return WriteInteger(stream, 0x80, 7, index);
@@ -92,6 +195,7 @@ namespace http
 			//TODO(h2) : Check the table size
 
 			_table_connector.Index(header_fields);
+			_table_version++;
 
 			return true;
 		}
@@ -12,6 +12,9 @@
 #include "data_structure.h"
 #include "table_connector.h"
 
+// The maximum number of header blocks cached in an encoder
+#define HPACK_HEADER_BLOCK_CACHE_SIZE 64
+
 namespace http
 {
 	// https://www.rfc-editor.org/rfc/rfc7541.html
@@ -31,6 +34,12 @@ namespace http
 
 			std::shared_ptr<ov::Data> Encode(const HeaderField &header_fields, EncodingType type);
 
+			// Encodes the header fields of a message into a header block.
+			// The fields that change in every message (e.g. content-length) are not indexed and are placed after the other fields.
+			// The rest is cached while the dynamic table is not changed, so a repeated header set costs only a few bytes of indexes
+			// and no Huffman encoding. Since the dynamic table is shared by the streams, the blocks must be encoded and sent in order.
+			std::shared_ptr<ov::Data> EncodeHeaderBlock(const std::vector<HeaderField> &header_fields);
+
 		private:
 			bool EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index);
 			bool EncodeLiteralHeaderFieldWithIndexing(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t name_index);
@@ -48,6 +57,20 @@ namespace http
 
 			TableConnector	_table_connector;
 			bool _need_signal_table_size_update = false;
+
+			struct CachedHeaderBlock
+			{
+				// The block is valid only while the dynamic table is the same as when it was encoded
+				uint64_t table_version = 0;
+				std::shared_ptr<const ov::Data> block;
+			};
+
+			static bool IsVolatileHeaderField(const ov::String &name);
+
+			// Increased whenever the dynamic table is changed
+			uint64_t _table_version = 0;
+			// key: "name: value\r\n" of the fields
+			std::unordered_map<ov::String, CachedHeaderBlock> _header_block_cache;
 		};
 	} // namespace hpack
 } // namespace http
\ No newline at end of file
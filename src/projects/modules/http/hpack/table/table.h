@@ -140,7 +140,23 @@ namespace http
 
 				auto header_field = _header_fields_table.back();
 				_header_fields_table.pop_back();
-				
+
+				// The oldest entry was inserted (_removed_count + 1)th. If a newer entry has the same name/value,
+				// the map points to the newer one and must be kept.
+				auto sequence = _removed_count + 1;
+
+				auto name_it = _header_field_name_sequence_map.find(header_field.GetName());
+				if ((name_it != _header_field_name_sequence_map.end()) && (name_it->second == sequence))
+				{
+					_header_field_name_sequence_map.erase(name_it);
+				}
+
+				auto key_it = _header_field_sequence_map.find(header_field.GetKey());
+				if ((key_it != _header_field_sequence_map.end()) && (key_it->second == sequence))
+				{
+					_header_field_sequence_map.erase(key_it);
+				}
+
 				_removed_count ++;
 				_table_usage -= header_field.GetSize();
 
@@ -137,6 +137,31 @@ namespace http
 					}
 				}
 
+				auto &file = GetResponseFile();
+
+				if (file != nullptr)
+				{
+					if (_chunked_transfer)
+					{
+						sent = ReadFileInChunks(file, HTTP_FILE_READ_CHUNK_SIZE, [this](const std::shared_ptr<const ov::Data> &chunk, bool is_last) -> bool {
+							return SendChunkedData(chunk);
+						});
+					}
+					else
+					{
+						sent = SendFile(file);
+					}
+
+					if (sent == false)
+					{
+						logte("Could not send file : %zu bytes", file->GetLength());
+						ResetResponseData();
+						return -1;
+					}
+
+					sent_bytes += file->GetLength();
+				}
+
 				ResetResponseData();
 
 				logtd("All datas are sent...");
@@ -0,0 +1,223 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http2_frame_scheduler.h"
+
+#include "../http_server_private.h"
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			Http2FrameScheduler::Http2FrameScheduler(const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<ov::TlsServerData> &tls_data)
+				: _client_socket(client_socket),
+				  _tls_data(tls_data)
+			{
+			}
+
+			void Http2FrameScheduler::Start()
+			{
+				// Keep the unsent data in the kernel small, so the scheduler decides the order of most of the data
+				_client_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_NOTSENT_LOWAT, HTTP2_TCP_NOTSENT_LOWAT);
+
+				std::weak_ptr<Http2FrameScheduler> weak_this = GetSharedPtr();
+
+				_client_socket->SetDispatchCompletedCallback([weak_this]() {
+					auto scheduler = weak_this.lock();
+					if (scheduler != nullptr)
+					{
+						scheduler->Flush();
+					}
+				});
+			}
+
+			void Http2FrameScheduler::Stop()
+			{
+				_client_socket->SetDispatchCompletedCallback(nullptr);
+
+				std::lock_guard<std::mutex> lock(_queue_mutex);
+
+				// The frames that have not been passed to the socket are discarded
+				_stopped = true;
+				_control_frames.clear();
+				_stream_frames.clear();
+
+				for (auto &streams : _active_streams)
+				{
+					streams.clear();
+				}
+			}
+
+			bool Http2FrameScheduler::SendControlFrame(const std::shared_ptr<const prot::h2::Http2Frame> &frame)
+			{
+				auto data = frame->ToData();
+
+				{
+					std::lock_guard<std::mutex> lock(_queue_mutex);
+
+					if (_stopped)
+					{
+						return false;
+					}
+
+					_control_frames.push_back(std::move(data));
+				}
+
+				Flush();
+
+				return _send_failed == false;
+			}
+
+			bool Http2FrameScheduler::SendDataFrame(uint32_t stream_id, uint8_t urgency, const std::shared_ptr<const prot::h2::Http2Frame> &frame)
+			{
+				auto data = frame->ToData();
+
+				{
+					std::lock_guard<std::mutex> lock(_queue_mutex);
+
+					if (_stopped)
+					{
+						return false;
+					}
+
+					auto &stream_frames = _stream_frames[stream_id];
+
+					if (stream_frames.frames.empty())
+					{
+						// The stream becomes active with the urgency of the current response
+						stream_frames.urgency = std::min(urgency, static_cast<uint8_t>(HTTP_URGENCY_LOWEST));
+						_active_streams[stream_frames.urgency].push_back(stream_id);
+					}
+
+					stream_frames.frames.push_back(std::move(data));
+				}
+
+				Flush();
+
+				return _send_failed == false;
+			}
+
+			std::mutex &Http2FrameScheduler::GetHeaderBlockMutex()
+			{
+				return _header_block_mutex;
+			}
+
+			void Http2FrameScheduler::Flush()
+			{
+				// Request before trying to become the flusher. If the flag were set after losing the race,
+				// the flusher could have already checked it and released _flushing, and nobody would send the frame
+				_flush_requested = true;
+
+				if (_flushing.exchange(true))
+				{
+					// Another thread is sending the frames, it will send the frames queued by this thread
+					return;
+				}
+
+				while (true)
+				{
+					_flush_requested = false;
+
+					while (_client_socket->GetDispatchQueueSize() < HTTP2_MAX_SOCKET_PENDING_FRAMES)
+					{
+						auto data = PopNextFrame();
+						if (data == nullptr)
+						{
+							break;
+						}
+
+						if (SendData(data) == false)
+						{
+							// The connection is broken, so the frames queued later are also discarded
+							_send_failed = true;
+							Stop();
+							break;
+						}
+					}
+
+					_flushing = false;
+
+					// If a frame is queued (or the socket is drained) while the flag is being released, this thread continues to send
+					if ((_flush_requested == false) || _flushing.exchange(true))
+					{
+						break;
+					}
+				}
+			}
+
+			std::shared_ptr<const ov::Data> Http2FrameScheduler::PopNextFrame()
+			{
+				std::lock_guard<std::mutex> lock(_queue_mutex);
+
+				if (_control_frames.empty() == false)
+				{
+					auto data = std::move(_control_frames.front());
+					_control_frames.pop_front();
+					return data;
+				}
+
+				for (auto &streams : _active_streams)
+				{
+					while (streams.empty() == false)
+					{
+						auto stream_id = streams.front();
+						streams.pop_front();
+
+						auto stream_frames_it = _stream_frames.find(stream_id);
+						if (stream_frames_it == _stream_frames.end())
+						{
+							continue;
+						}
+
+						auto &stream_frames = stream_frames_it->second;
+						auto data = std::move(stream_frames.frames.front());
+						stream_frames.frames.pop_front();
+
+						if (stream_frames.frames.empty())
+						{
+							_stream_frames.erase(stream_frames_it);
+						}
+						else
+						{
+							// Next stream of the same urgency sends the next frame
+							streams.push_back(stream_id);
+						}
+
+						return data;
+					}
+				}
+
+				return nullptr;
+			}
+
+			bool Http2FrameScheduler::SendData(const std::shared_ptr<const ov::Data> &data)
+			{
+				std::shared_ptr<const ov::Data> send_data = data;
+
+				if (_tls_data != nullptr)
+				{
+					if (_tls_data->Encrypt(data, &send_data) == false)
+					{
+						logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
+						return false;
+					}
+
+					if ((send_data == nullptr) || send_data->IsEmpty())
+					{
+						// There is no data to send
+						return true;
+					}
+				}
+
+				return _client_socket->Send(send_data);
+			}
+		}  // namespace h2
+	}	   // namespace svr
+}  // namespace http
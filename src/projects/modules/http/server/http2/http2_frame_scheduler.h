@@ -0,0 +1,91 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/ovcrypto.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/client_socket.h>
+
+#include <array>
+#include <deque>
+#include <unordered_map>
+
+#include "../../protocol/http2/frames/http2_frames.h"
+#include "../http_response.h"
+
+// The maximum number of frames waiting in the dispatch queue of the socket.
+// The rest of the frames wait in the scheduler, so the frames of a more urgent response can overtake them.
+#define HTTP2_MAX_SOCKET_PENDING_FRAMES 4
+// Unsent bytes that the kernel keeps for the socket (TCP_NOTSENT_LOWAT).
+// Without this, a large response fills the kernel buffer and a more urgent response waits behind it.
+#define HTTP2_TCP_NOTSENT_LOWAT (64 * 1024)
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			// Sends the frames of all the streams of a HTTP/2 connection in order of priority.
+			//
+			// - Connection control frames and HEADERS/CONTINUATION frames are sent first, in the order they are queued
+			//   (HPACK requires the header blocks to be decoded in the order they are encoded)
+			// - DATA frames are sent by the urgency of the response (RFC 9218), and the streams of the same urgency
+			//   are interleaved frame by frame (round robin)
+			//
+			// The frames are passed to the socket only while the socket has few pending frames,
+			// and the scheduler continues when the socket has sent them.
+			class Http2FrameScheduler : public ov::EnableSharedFromThis<Http2FrameScheduler>
+			{
+			public:
+				Http2FrameScheduler(const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<ov::TlsServerData> &tls_data);
+
+				// Registers the callback to the socket, must be called once after creation
+				void Start();
+				// Discards the queued frames, and frames are not queued anymore
+				void Stop();
+
+				bool SendControlFrame(const std::shared_ptr<const prot::h2::Http2Frame> &frame);
+				bool SendDataFrame(uint32_t stream_id, uint8_t urgency, const std::shared_ptr<const prot::h2::Http2Frame> &frame);
+
+				// Must be locked while a header block is encoded and queued
+				std::mutex &GetHeaderBlockMutex();
+
+			private:
+				struct StreamFrames
+				{
+					uint8_t urgency = HTTP_URGENCY_DEFAULT;
+					std::deque<std::shared_ptr<const ov::Data>> frames;
+				};
+
+				void Flush();
+				std::shared_ptr<const ov::Data> PopNextFrame();
+				bool SendData(const std::shared_ptr<const ov::Data> &data);
+
+				std::shared_ptr<ov::ClientSocket> _client_socket;
+				std::shared_ptr<ov::TlsServerData> _tls_data;
+
+				std::mutex _header_block_mutex;
+
+				std::mutex _queue_mutex;
+				bool _stopped = false;
+				std::deque<std::shared_ptr<const ov::Data>> _control_frames;
+				// [STREAM_ID, FRAMES]
+				std::unordered_map<uint32_t, StreamFrames> _stream_frames;
+				// Streams that have frames to send for each urgency, in round robin order
+				std::array<std::deque<uint32_t>, HTTP_URGENCY_LOWEST + 1> _active_streams;
+
+				// Only one thread sends the frames at a time
+				std::atomic<bool> _flushing{false};
+				std::atomic<bool> _flush_requested{false};
+				std::atomic<bool> _send_failed{false};
+			};
+		}  // namespace h2
+	}	   // namespace svr
+}  // namespace http
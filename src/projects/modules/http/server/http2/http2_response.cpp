@@ -16,16 +16,22 @@ namespace http
 		namespace h2
 		{
 			// Constructor
-			Http2Response::Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder)
+			Http2Response::Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder, const std::shared_ptr<Http2FrameScheduler> &frame_scheduler)
 				: HttpResponse(client_socket)
 			{
 				_stream_id = stream_id;
 				_hpack_encoder = hpack_encoder;
+				_frame_scheduler = frame_scheduler;
 			}
 
 			bool Http2Response::Send(const std::shared_ptr<prot::h2::Http2Frame> &frame)
 			{
-				return HttpResponse::Send(frame->ToData());
+				if (frame->GetType() == prot::h2::Http2Frame::Type::Data)
+				{
+					return _frame_scheduler->SendDataFrame(_stream_id, GetUrgency(), frame);
+				}
+
+				return _frame_scheduler->SendControlFrame(frame);
 			}
 
 			void Http2Response::SetKeepStream(bool keep_stream)
@@ -47,12 +53,14 @@ namespace http
 
 			int32_t Http2Response::SendHeader()
 			{
-				std::shared_ptr<ov::Data> header_block = std::make_shared<ov::Data>(65535);
+				// The header blocks must be sent in the order they are encoded, since the HPACK encoder is shared by the streams
+				std::lock_guard<std::mutex> header_block_lock(_frame_scheduler->GetHeaderBlockMutex());
+
 				size_t sent_size = 0;
 
 				// :status header field is must on top
-				auto header_field = _hpack_encoder->Encode({":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode()))}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-				header_block->Append(header_field);
+				std::vector<hpack::HeaderField> header_fields;
+				header_fields.emplace_back(":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode())));
 
 				for (const auto &[name, values] : GetResponseHeaderList())
 				{
@@ -60,11 +68,17 @@ namespace http
 					{
 						// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
 						// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
-						auto header_field = _hpack_encoder->Encode({name.LowerCaseString(), value}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-						header_block->Append(header_field);
+						header_fields.emplace_back(name.LowerCaseString(), value);
 					}
 				}
 
+				auto header_block = _hpack_encoder->EncodeHeaderBlock(header_fields);
+				if (header_block == nullptr)
+				{
+					logte("Failed to encode header block : stream(%u)", _stream_id);
+					return -1;
+				}
+
 				logtd("[Http2Response] Send header block : size(%u)", header_block->GetLength());
 
 				std::shared_ptr<ov::Data> head_block_fragment;
@@ -141,6 +155,7 @@ namespace http
 				logtd("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
+				auto &file = GetResponseFile();
 
 				for (const auto &data : GetResponseDataList())
 				{
@@ -169,7 +184,7 @@ namespace http
 					payload_frame->SetData(data_fragment);
 
 					// End Stream
-					if (_keep_stream == false && (&data == &GetResponseDataList().back()))
+					if (_keep_stream == false && (file == nullptr) && (&data == &GetResponseDataList().back()))
 					{
 						payload_frame->SetEndStream();
 					}
@@ -184,6 +199,41 @@ namespace http
 					sent_bytes += data->GetLength();
 				}
 
+				if (file != nullptr)
+				{
+					// The file is read in DATA frame sized chunks, since the frames are encrypted by TLS anyway
+					auto sent = ReadFileInChunks(file, MAX_HTTP2_DATA_SIZE, [this](const std::shared_ptr<const ov::Data> &chunk, bool is_last) -> bool {
+						auto payload_frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
+						payload_frame->SetData(chunk);
+
+						if (is_last && (_keep_stream == false))
+						{
+							payload_frame->SetEndStream();
+						}
+
+						return Send(payload_frame);
+					});
+
+					if ((sent == true) && (file->GetLength() == 0) && (_keep_stream == false))
+					{
+						// No chunk has been sent for an empty file, so the stream must be ended with an empty DATA frame
+						auto payload_frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
+						payload_frame->SetData(std::make_shared<ov::Data>());
+						payload_frame->SetEndStream();
+
+						sent = Send(payload_frame);
+					}
+
+					if (sent == false)
+					{
+						logte("Failed to send file payload");
+						ResetResponseData();
+						return -1;
+					}
+
+					sent_bytes += file->GetLength();
+				}
+
 				ResetResponseData();
 
 				logtd("All datas are sent...");
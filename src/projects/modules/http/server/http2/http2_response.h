@@ -12,6 +12,7 @@
 #include "../http_response.h"
 #include "../../protocol/http2/frames/http2_frames.h"
 #include "../../hpack/encoder.h"
+#include "http2_frame_scheduler.h"
 
 #define MAX_HTTP2_HEADER_SIZE (1024 * 1024)
 #define MAX_HTTP2_DATA_SIZE (16384)
@@ -26,8 +27,9 @@ namespace http
 			{
 			public:
 				// Constructor
-				Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder);
+				Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder, const std::shared_ptr<Http2FrameScheduler> &frame_scheduler);
 
+				// The frame is queued to the scheduler of the connection, and sent by the urgency of the response
 				bool Send(const std::shared_ptr<prot::h2::Http2Frame> &frame);
 
 				// After Response(), EndStream flag is not sent.
@@ -44,6 +46,7 @@ namespace http
 				uint32_t _stream_id = 0;
 				bool _keep_stream = false;
 				std::shared_ptr<hpack::Encoder> _hpack_encoder;
+				std::shared_ptr<Http2FrameScheduler> _frame_scheduler;
 			};
 		}
 	}
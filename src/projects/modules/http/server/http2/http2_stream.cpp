@@ -24,7 +24,7 @@ namespace http
 				_request->SetConnectionType(ConnectionType::Http20);
 				_request->SetTlsData(GetConnection()->GetTlsData());
 
-				_response = std::make_shared<Http2Response>(stream_id, GetConnection()->GetSocket(), GetConnection()->GetHpackEncoder());
+				_response = std::make_shared<Http2Response>(stream_id, GetConnection()->GetSocket(), GetConnection()->GetHpackEncoder(), GetConnection()->GetHttp2FrameScheduler());
 				_response->SetTlsData(GetConnection()->GetTlsData());
 				_response->SetHeader("server", "OvenMediaEngine");
 				_response->SetHeader("content-type", "text/html");
@@ -75,6 +75,14 @@ namespace http
 				// HTTP/2 Connection is awalys keep-alive
 				SetKeepAlive(true);
 
+				// https://www.rfc-editor.org/rfc/rfc9218.html#section-4
+				// The application can override it by HttpResponse::SetUrgency()
+				auto priority = _request->GetHeader("priority");
+				if (priority.IsEmpty() == false)
+				{
+					_response->SetUrgency(UrgencyFromPriorityHeader(priority));
+				}
+
 				// Notify to interceptor
 				if (OnRequestPrepared() == false)
 				{
@@ -94,6 +102,35 @@ namespace http
 				return true;
 			}
 
+			uint8_t HttpStream::UrgencyFromPriorityHeader(const ov::String &priority)
+			{
+				// priority: u=<urgency>, i
+				for (const auto &parameter : priority.Split(","))
+				{
+					auto key_value = parameter.Trim().Split("=");
+
+					if ((key_value.size() == 2) && (key_value[0].Trim() == "u"))
+					{
+						auto value = key_value[1].Trim();
+
+						// ToInt32() returns 0 (the highest urgency) for a non-numeric value
+						if (value.IsEmpty() || (value.IsNumeric() == false))
+						{
+							break;
+						}
+
+						auto urgency = ov::Converter::ToInt32(value);
+
+						if ((urgency >= HTTP_URGENCY_HIGHEST) && (urgency <= HTTP_URGENCY_LOWEST))
+						{
+							return static_cast<uint8_t>(urgency);
+						}
+					}
+				}
+
+				return HTTP_URGENCY_DEFAULT;
+			}
+
 			bool HttpStream::OnEndStream()
 			{
 				// End of Stream, that means no more data will be sent
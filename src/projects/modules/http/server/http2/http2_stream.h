@@ -42,6 +42,9 @@ namespace http
 				// Send Settings frame and Window_Update frame
 				bool SendInitialControlMessage();
 
+				// Parses the urgency of "priority" request header (RFC 9218)
+				static uint8_t UrgencyFromPriorityHeader(const ov::String &priority);
+
 				bool OnEndHeaders();
 				bool OnEndStream();
 				
@@ -66,23 +66,54 @@ namespace http
 				_tls_data ? "Enabled" : "Disabled");
 		}
 		
-		// Called every 5 seconds
-		bool HttpConnection::OnRepeatTask()
+		void HttpConnection::StartTimer(ov::TimerWheel &timer_wheel)
 		{
-			if (_connection_type == ConnectionType::WebSocket)
-			{
-				if (_websocket_session != nullptr)
+			std::lock_guard<std::recursive_mutex> lock(_close_mutex);
+
+			_timer_wheel = &timer_wheel;
+
+			std::weak_ptr<HttpConnection> weak_this = GetSharedPtr();
+			_timer_id = _timer_wheel->Arm(HTTP_CONNECTION_TIMEOUT_MS, [weak_this]() {
+				auto connection = weak_this.lock();
+				if (connection != nullptr)
 				{
-					_websocket_session->Ping();
+					connection->OnTimer();
 				}
+			});
+		}
+
+		void HttpConnection::OnTimer()
+		{
+			std::lock_guard<std::recursive_mutex> lock(_close_mutex);
+			if (_closed == true)
+			{
+				return;
 			}
 
-			CheckTimeout();
+			auto next_timer_ms = CheckTimeout();
+			if (next_timer_ms < 0)
+			{
+				// Closed
+				return;
+			}
 
-			return true;
+			if ((_connection_type == ConnectionType::WebSocket) && (_websocket_session != nullptr))
+			{
+				_websocket_session->Ping();
+				next_timer_ms = std::min(next_timer_ms, _websocket_session->GetTimeToNextPingMs());
+			}
+
+			std::weak_ptr<HttpConnection> weak_this = GetSharedPtr();
+			_timer_id = _timer_wheel->Arm(next_timer_ms, [weak_this]() {
+				auto connection = weak_this.lock();
+				if (connection != nullptr)
+				{
+					connection->OnTimer();
+				}
+			});
 		}
 
-		void HttpConnection::CheckTimeout()
+		int64_t HttpConnection::CheckTimeout()
 		{
 			// Check timeout 
 			auto current = std::chrono::high_resolution_clock::now();
@@ -94,13 +125,18 @@ namespace http
 				case ConnectionType::Http10:
 				case ConnectionType::Http11:
 				case ConnectionType::Http20:
-					if (std::min(elapsed_time_from_last_recv, elapsed_time_from_last_sent) > HTTP_CONNECTION_TIMEOUT_MS)
+				{
+					auto idle_time = std::min(elapsed_time_from_last_recv, elapsed_time_from_last_sent);
+					if (idle_time > HTTP_CONNECTION_TIMEOUT_MS)
 					{
 						// Close connection
 						logti("Client(%s - %s) has timed out", StringFromConnectionType(_connection_type).CStr(), _client_socket->ToString().CStr());
 						Close(PhysicalPortDisconnectReason::Disconnect);
+						return -1;
 					}
-					break;
+
+					return HTTP_CONNECTION_TIMEOUT_MS - idle_time;
+				}
 				case ConnectionType::WebSocket:
 					// In websocket, if Pong does not arrive for a certain period of time, timeout should be processed. (It takes a very long time to check disconnected by ping transmission because it can be mistaken for sending a ping to a dead client.)
 					if (elapsed_time_from_last_recv > WEBSOCKET_CONNECTION_TIMEOUT_MS)
@@ -108,9 +144,12 @@ namespace http
 						// Close connection
 						logti("Client(%s - %s) has timed out", StringFromConnectionType(_connection_type).CStr(),_client_socket->ToString().CStr());
 						Close(PhysicalPortDisconnectReason::Disconnect);
+						return -1;
 					}
+
+					return WEBSOCKET_CONNECTION_TIMEOUT_MS - elapsed_time_from_last_recv;
 				default:
-					return;
+					return HTTP_CONNECTION_TIMEOUT_MS;
 			}
 		}
 
@@ -194,6 +233,11 @@ namespace http
 			return _hpack_encoder;
 		}
 
+		std::shared_ptr<h2::Http2FrameScheduler> HttpConnection::GetHttp2FrameScheduler() const
+		{
+			return _http2_frame_scheduler;
+		}
+
 		std::shared_ptr<hpack::Decoder> HttpConnection::GetHpackDecoder() const
 		{
 			return _hpack_decoder;
@@ -235,6 +279,11 @@ namespace http
 				return;
 			}
 
+			if (_timer_wheel != nullptr)
+			{
+				_timer_wheel->Cancel(_timer_id);
+			}
+
 			if (_interceptor != nullptr)
 			{
 				_interceptor->OnClosed(GetSharedPtr(), reason);
@@ -259,6 +308,11 @@ namespace http
 			_http_stream_map.clear();
 			map_guard.unlock();
 
+			if (_http2_frame_scheduler != nullptr)
+			{
+				_http2_frame_scheduler->Stop();
+			}
+
 			if (reason != PhysicalPortDisconnectReason::Disconnected)
 			{
 				_client_socket->Close();
@@ -489,6 +543,9 @@ namespace http
 			_hpack_encoder = std::make_shared<hpack::Encoder>();
 			_hpack_decoder = std::make_shared<hpack::Decoder>();
 
+			_http2_frame_scheduler = std::make_shared<h2::Http2FrameScheduler>(_client_socket, _tls_data);
+			_http2_frame_scheduler->Start();
+
 			// Control Stream (stream id : 0) is always open
 			std::unique_lock<std::mutex> lock(_http_stream_map_guard);
 			_http_stream_map.emplace(0, std::make_shared<h2::HttpStream>(GetSharedPtr(), 0));
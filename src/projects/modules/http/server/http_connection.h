@@ -40,7 +40,8 @@ namespace http
 
 			void OnExchangeCompleted(const std::shared_ptr<HttpExchange> &exchange);
 
-			bool OnRepeatTask();
+			// Arms the timer for the idle timeout (and the ping of WebSocket), called once after the connection is created
+			void StartTimer(ov::TimerWheel &timer_wheel);
 
 			void SetTlsData(const std::shared_ptr<ov::TlsServerData> &tls_data);
 			void OnTlsAccepted();
@@ -63,6 +64,8 @@ namespace http
 			// Get HPACK Codec
 			std::shared_ptr<hpack::Encoder> GetHpackEncoder() const;
 			std::shared_ptr<hpack::Decoder> GetHpackDecoder() const;
+			// Sends the frames of the HTTP/2 streams by priority
+			std::shared_ptr<h2::Http2FrameScheduler> GetHttp2FrameScheduler() const;
 
 			// To string
 			virtual ov::String ToString() const;
@@ -90,7 +93,9 @@ namespace http
 
 			void InitializeHttp2Connection();
 
-			void CheckTimeout();
+			void OnTimer();
+			// Returns the time until the connection times out, or -1 if it has timed out and been closed
+			int64_t CheckTimeout();
 
 			// User Data
 			std::any _user_data;
@@ -122,6 +127,7 @@ namespace http
 			// HTTP/2 HPACK Codec
 			std::shared_ptr<hpack::Encoder> _hpack_encoder = nullptr;
 			std::shared_ptr<hpack::Decoder> _hpack_decoder = nullptr;
+			std::shared_ptr<h2::Http2FrameScheduler> _http2_frame_scheduler = nullptr;
 
 			///////////////////////
 			// For Websocket
@@ -133,6 +139,10 @@ namespace http
 			std::shared_ptr<RequestInterceptor> _interceptor = nullptr;
 
 			std::recursive_mutex _close_mutex;
+
+			// The timer is armed at the time the connection may time out, instead of checking all the connections periodically
+			ov::TimerWheel *_timer_wheel = nullptr;
+			ov::TimerId _timer_id = 0;
 			bool _closed = false;
 		};
 	} // namespace svr
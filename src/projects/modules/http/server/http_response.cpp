@@ -37,8 +37,10 @@ namespace http
 			_status_code = http_response->_status_code;
 			_reason = http_response->_reason;
 			_is_header_sent = http_response->_is_header_sent;
+			_urgency = http_response->_urgency;
 			_response_header = http_response->_response_header;
 			_response_data_list = http_response->_response_data_list;
+			_response_file = http_response->_response_file;
 			_response_data_size = http_response->_response_data_size;
 			_default_value = http_response->_default_value;
 			_created_time = http_response->_created_time;
@@ -170,8 +172,25 @@ namespace http
 
 		bool HttpResponse::AppendFile(const ov::String &filename)
 		{
-			OV_ASSERT(false, "Not implemented");
-			return false;
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (_response_file != nullptr)
+			{
+				logte("Only one file can be appended to the response: %s", filename.CStr());
+				return false;
+			}
+
+			auto file = ov::FileRegion::Open(filename);
+
+			if (file == nullptr)
+			{
+				return false;
+			}
+
+			_response_file = file;
+			_response_data_size += file->GetLength();
+
+			return true;
 		}
 
 		bool HttpResponse::IsHeaderSent() const
@@ -191,6 +210,11 @@ namespace http
 			return _response_data_list;
 		}
 
+		const std::shared_ptr<const ov::FileRegion> &HttpResponse::GetResponseFile() const
+		{
+			return _response_file;
+		}
+
 		// Get Response Header
 		const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &HttpResponse::GetResponseHeaderList() const
 		{
@@ -200,6 +224,7 @@ namespace http
 		void HttpResponse::ResetResponseData()
 		{
 			_response_data_list.clear();
+			_response_file = nullptr;
 			_response_data_size = 0ULL;
 		}
 
@@ -221,6 +246,16 @@ namespace http
 			return _sent_size;
 		}
 
+		void HttpResponse::SetUrgency(uint8_t urgency)
+		{
+			_urgency = std::min(urgency, static_cast<uint8_t>(HTTP_URGENCY_LOWEST));
+		}
+
+		uint8_t HttpResponse::GetUrgency() const
+		{
+			return _urgency;
+		}
+
 		int32_t HttpResponse::Response()
 		{
 			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
@@ -304,6 +339,52 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::SendFile(const std::shared_ptr<const ov::FileRegion> &file)
+		{
+			if (file == nullptr)
+			{
+				OV_ASSERT2(file != nullptr);
+				return false;
+			}
+
+			if (_tls_data == nullptr)
+			{
+				// The file is sent from the page cache to the socket directly
+				return _client_socket->SendFile(file);
+			}
+
+			return ReadFileInChunks(file, HTTP_FILE_READ_CHUNK_SIZE, [this](const std::shared_ptr<const ov::Data> &chunk, bool is_last) -> bool {
+				return Send(chunk);
+			});
+		}
+
+		bool HttpResponse::ReadFileInChunks(const std::shared_ptr<const ov::FileRegion> &file, size_t chunk_size, const std::function<bool(const std::shared_ptr<const ov::Data> &chunk, bool is_last)> &handler)
+		{
+			size_t offset = 0;
+			size_t file_length = file->GetLength();
+
+			while (offset < file_length)
+			{
+				auto length = std::min(chunk_size, file_length - offset);
+				auto chunk = file->Read(offset, length);
+
+				if (chunk == nullptr)
+				{
+					logte("Could not read the file to send: %s", _client_socket->ToString().CStr());
+					return false;
+				}
+
+				offset += length;
+
+				if (handler(chunk, offset == file_length) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
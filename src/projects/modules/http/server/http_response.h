@@ -11,6 +11,16 @@
 #include <base/ovlibrary/converter.h>
 #include "../http_datastructure.h"
 
+// When the file cannot be sent using sendfile() (TLS, HTTP/2), it is read and sent in chunks of this size
+#define HTTP_FILE_READ_CHUNK_SIZE (64 * 1024)
+
+// Urgency of the Extensible Priorities (RFC 9218). The lower value is the more urgent.
+#define HTTP_URGENCY_HIGHEST 0
+#define HTTP_URGENCY_HIGH 1
+#define HTTP_URGENCY_ABOVE_DEFAULT 2
+#define HTTP_URGENCY_DEFAULT 3
+#define HTTP_URGENCY_LOWEST 7
+
 namespace http
 {
 	namespace svr
@@ -50,8 +60,15 @@ namespace http
 			// Can be used for response with content-length
 			bool AppendData(const std::shared_ptr<const ov::Data> &data);
 			bool AppendString(const ov::String &string);
+			// The file is not loaded into memory, and it is sent after the data appended by AppendData()/AppendString()
+			// (Only one file can be appended per response)
 			bool AppendFile(const ov::String &filename);
 
+			// HTTP/2 sends the frames of the more urgent responses first when the responses are sent concurrently on a connection.
+			// It is initialized with the "priority" header of the request, and the application can override it. (HTTP/1.1 ignores it)
+			void SetUrgency(uint8_t urgency);
+			uint8_t GetUrgency() const;
+
 			int32_t Response();
 
 			// Get Created Time
@@ -72,6 +89,8 @@ namespace http
 			
 			// Get Response Data List
 			const std::vector<std::shared_ptr<const ov::Data>> &GetResponseDataList() const;
+			// Get Response File (nullptr if AppendFile() is not called)
+			const std::shared_ptr<const ov::FileRegion> &GetResponseFile() const;
 			// Get Response Header
 			const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaderList() const;
 			void ResetResponseData();
@@ -84,7 +103,11 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
-			
+			// Uses sendfile() if TLS is not used, otherwise reads the file in chunks and sends them after encryption
+			bool SendFile(const std::shared_ptr<const ov::FileRegion> &file);
+			// Reads the file in chunks of <chunk_size> bytes, and calls <handler> for each chunk
+			bool ReadFileInChunks(const std::shared_ptr<const ov::FileRegion> &file, size_t chunk_size, const std::function<bool(const std::shared_ptr<const ov::Data> &chunk, bool is_last)> &handler);
+
 		private:
 			virtual int32_t SendHeader();
 			virtual int32_t SendPayload();
@@ -96,6 +119,7 @@ namespace http
 			ov::String _reason = StringFromStatusCode(StatusCode::OK);
 
 			bool _is_header_sent = false;
+			uint8_t _urgency = HTTP_URGENCY_DEFAULT;
 			
 			// FIXME(dimiden): It is supposed to be synchronized whenever a packet is sent, but performance needs to be improved
 			std::recursive_mutex _response_mutex;
@@ -114,6 +138,8 @@ namespace http
 			// So _response_header is a map of case insentitive header key and value
 			std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _response_header;
 			std::vector<std::shared_ptr<const ov::Data>> _response_data_list;
+			std::shared_ptr<const ov::FileRegion> _response_file;
+			// The size of _response_data_list + _response_file
 			size_t _response_data_size = 0;
 
 			std::vector<ov::String> _default_value{};
@@ -17,7 +17,7 @@ namespace http
 {
 	namespace svr
 	{
-		ov::DelayQueue HttpServer::_repeater{"HTTPTimer"};
+		ov::TimerWheelPool HttpServer::_timer_wheels{"HTTPTimer", HTTP_SERVER_TIMER_WHEEL_COUNT};
 
 		HttpServer::HttpServer(const char *server_name, const char *server_short_name)
 			: _server_name(server_name),
@@ -53,8 +53,8 @@ namespace http
 				{
 					_physical_port = physical_port;
 
-					_repeater.Push(std::bind(&HttpServer::Repeater, this, std::placeholders::_1), 5 * 1000);
-					_repeater.Start();
+					// The wheels are shared by the servers, so they are started once and never stopped
+					_timer_wheels.Start();
 
 					return true;
 				}
@@ -99,25 +99,9 @@ namespace http
 
 			_interceptor_list.clear();
 
-			_repeater.Stop();
-
 			return true;
 		}
 
-		ov::DelayQueueAction HttpServer::Repeater(void *parameter)
-		{
-			std::shared_lock<std::shared_mutex> guard(_client_list_mutex);
-			auto client_list = _connection_list;
-			guard.unlock();
-
-			for (const auto &item : client_list)
-			{
-				item.second->OnRepeatTask();
-			}
-
-			return ov::DelayQueueAction::Repeat;
-		}
-
 		bool HttpServer::IsRunning() const
 		{
 			auto lock_guard = std::lock_guard(_physical_port_mutex);
@@ -160,6 +144,8 @@ namespace http
 			auto http_connection = std::make_shared<HttpConnection>(GetSharedPtr(), client_socket);
 			_connection_list[remote.get()] = http_connection;
 
+			http_connection->StartTimer(_timer_wheels.GetWheel(client_socket->GetNativeHandle()));
+
 			return http_connection;
 		}
 
@@ -17,6 +17,8 @@
 #include "http_default_interceptor.h"
 
 #define HTTP_SERVER_USE_DEFAULT_COUNT PHYSICAL_PORT_USE_DEFAULT_COUNT
+// Connections are distributed over the wheels by socket id
+#define HTTP_SERVER_TIMER_WHEEL_COUNT 4
 
 // References
 //
@@ -91,9 +93,8 @@ namespace http
 			std::vector<std::shared_ptr<ocst::VirtualHost>> _virtual_host_list;
 
 		private:
-			ov::DelayQueueAction Repeater(void *parameter);
-
-			static ov::DelayQueue _repeater;
+			// Idle timeouts of the connections of all the servers
+			static ov::TimerWheelPool _timer_wheels;
 
 			bool _http2_enabled = true;
 		};
@@ -99,6 +99,11 @@ namespace http
 				return _ws_response->Send(_ping_data, FrameOpcode::Ping) > 0;
 			}
 
+			int64_t WebSocketSession::GetTimeToNextPingMs() const
+			{
+				return std::max<int64_t>((WEBSOCKET_PING_INTERVAL_MS) - _ping_timer.Elapsed(), 0);
+			}
+
 			bool WebSocketSession::OnFrameReceived(const std::shared_ptr<const prot::ws::Frame> &frame)
 			{
 				auto interceptor = GetConnection()->FindInterceptor(GetSharedPtr());
@@ -36,6 +36,8 @@ namespace http
 
 				// Ping
 				bool Ping();
+				// Time until Ping() sends the next ping
+				int64_t GetTimeToNextPingMs() const;
 
 				bool OnFrameReceived(const std::shared_ptr<const prot::ws::Frame> &frame);
 
@@ -25,23 +25,17 @@
 
 IcePort::IcePort()
 {
-	_timer.Push(
-		[this](void *paramter) -> ov::DelayQueueAction {
-			CheckTimedOut();
-			return ov::DelayQueueAction::Repeat;
-		},
-		1000);
-	_timer.Start();
+	_timer_wheels.Start();
 }
 
 IcePort::~IcePort()
 {
-	_timer.Stop();
+	_timer_wheels.Stop();
 
 	Close();
 }
 
-bool IcePort::CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count)
+bool IcePort::CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count, bool batched_egress)
 {
 	std::lock_guard<std::recursive_mutex> lock_guard(_physical_port_list_mutex);
 
@@ -96,6 +90,16 @@ bool IcePort::CreateIceCandidates(const char *server_name, const cfg::Server &se
 					break;
 				}
 
+				if (batched_egress && (socket_type == ov::SocketType::Udp))
+				{
+					auto datagram_socket = std::dynamic_pointer_cast<ov::DatagramSocket>(physical_port->GetSocket());
+
+					if (datagram_socket != nullptr)
+					{
+						datagram_socket->SetBatchedEgress(true);
+					}
+				}
+
 				ice_address_string_list.push_back(
 					ov::String::FormatString(
 						"%s/%s (%p)",
@@ -232,7 +236,7 @@ bool IcePort::Close()
 		}
 	}
 
-	_timer.Stop();
+	_timer_wheels.Stop();
 
 	return result;
 }
@@ -282,20 +286,12 @@ bool IcePort::AddIceSession(const ov::String &local_ufrag, const std::shared_ptr
 
 bool IcePort::AddIceSession(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(address_pair);
-	if (item == _ice_sessions_with_address_pair.end())
-	{
-		_ice_sessions_with_address_pair.emplace(address_pair, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_address_pair.Add(address_pair, ice_session);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(session_id_t session_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
+	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
 	auto item = _ice_seesions_with_id.find(session_id);
 	if (item != _ice_seesions_with_id.end())
 	{
@@ -319,14 +315,7 @@ std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::String &local_ufra
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::SocketAddressPair &socket_address_pair)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(socket_address_pair);
-	if (item != _ice_sessions_with_address_pair.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_address_pair.Find(socket_address_pair);
 }
 
 session_id_t IcePort::IssueUniqueSessionId()
@@ -365,6 +354,8 @@ void IcePort::AddSession(const std::shared_ptr<IcePortObserver> &observer, sessi
 		return;
 	}
 
+	ArmSessionTimer(new_session, new_session->GetRemainingTimeMs());
+
 	logti("Added session: %d (ufrag: %s:%s)", session_id, local_ufrag.CStr(), peer_ufrag.CStr());
 }
 
@@ -377,8 +368,9 @@ bool IcePort::DisconnectSession(session_id_t session_id)
 		return false;
 	}
 
-	// It will be deleted in the next timer (for thread safety)
+	// It will be deleted in the next tick of the timer (for thread safety)
 	ice_session->SetState(IceConnectionState::Disconnecting);
+	ArmSessionTimer(ice_session, 0);
 
 	return true;
 }
@@ -412,13 +404,12 @@ bool IcePort::RemoveSession(session_id_t session_id)
 
 	// Remove from _ice_sessions_with_address_pair if it exists
 	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
 		auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
 		if (connected_candidate_pair != nullptr)
 		{
-			_ice_sessions_with_address_pair.erase(connected_candidate_pair->GetAddressPair());
+			_ice_sessions_with_address_pair.Remove(connected_candidate_pair->GetAddressPair());
 		}
-		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.size();
+		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.GetCount();
 	}
 
 	{
@@ -450,6 +441,11 @@ bool IcePort::StoreIceSessionWithTransactionId(const std::shared_ptr<IceSession>
 
 	_binding_requests_with_transaction_id.emplace(transaction_id, BindingRequestInfo(transaction_id, ice_session));
 
+	_timer_wheels.GetWheel(ice_session->GetSessionID()).Arm(ICE_BINDING_REQUEST_TIMEOUT_MS, [this, transaction_id]() {
+		// The response has not arrived
+		RemoveTransaction(transaction_id);
+	});
+
 	return true;
 }
 
@@ -479,61 +475,53 @@ bool IcePort::RemoveTransaction(const ov::String &transaction_id)
 	return true;
 }
 
-void IcePort::CheckTimedOut()
+void IcePort::ArmSessionTimer(const std::shared_ptr<IceSession> &ice_session, int64_t after_ms)
 {
-	// Remove expired transction items
-	{
-		std::lock_guard<std::shared_mutex> brt_lock(_binding_requests_with_transaction_id_lock);
+	std::weak_ptr<IceSession> weak_session = ice_session;
 
-		for (auto it = _binding_requests_with_transaction_id.begin(); it != _binding_requests_with_transaction_id.end();)
+	_timer_wheels.GetWheel(ice_session->GetSessionID()).Arm(after_ms, [this, weak_session]() {
+		auto ice_session = weak_session.lock();
+		if (ice_session != nullptr)
 		{
-			if (it->second.IsExpired())
-			{
-				it = _binding_requests_with_transaction_id.erase(it);
-			}
-			else
-			{
-				++it;
-			}
+			OnSessionTimer(ice_session);
 		}
-	}
+	});
+}
 
-	// Collect terminated sessions for thread safety
-	std::vector<std::shared_ptr<IceSession>> terminated_session_list;
+void IcePort::OnSessionTimer(const std::shared_ptr<IceSession> &ice_session)
+{
+	// The session may have been removed by another timer (e.g. disconnected and expired at the same time)
+	if (FindIceSession(ice_session->GetSessionID()) != ice_session)
 	{
-		std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-
-		for (const auto &item : _ice_seesions_with_id)
-		{
-			auto session = item.second;
-			if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
-			{
-				terminated_session_list.push_back(session);
-			}
-		}
+		return;
 	}
 
-	// Remove terminated sessions and notify
-	for (auto &terminated_session : terminated_session_list)
+	bool expired = ice_session->IsExpired();
+
+	if ((expired == false) && (ice_session->GetState() != IceConnectionState::Disconnecting))
 	{
-		RemoveSession(terminated_session->GetSessionID());
+		// Refreshed after the timer was armed
+		ArmSessionTimer(ice_session, ice_session->GetRemainingTimeMs());
+		return;
+	}
 
-		auto connected_candidate_pair = terminated_session->GetConnectedCandidatePair();
+	RemoveSession(ice_session->GetSessionID());
 
-		if (terminated_session->IsExpired())
-		{
-			terminated_session->SetState(IceConnectionState::Disconnected);
+	auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
 
-			logtw("Agent [%s, %u] has expired", connected_candidate_pair != nullptr ? connected_candidate_pair->ToString().CStr() : "Unknow", terminated_session->GetSessionID());
-		}
-		else
-		{
-			terminated_session->SetState(IceConnectionState::Closed);
-			logti("Agent [%s, %u] has closed", connected_candidate_pair != nullptr ? connected_candidate_pair->ToString().CStr() : "Unknow", terminated_session->GetSessionID());
-		}
+	if (expired)
+	{
+		ice_session->SetState(IceConnectionState::Disconnected);
 
-		NotifyIceSessionStateChanged(terminated_session);
+		logtw("Agent [%s, %u] has expired", connected_candidate_pair != nullptr ? connected_candidate_pair->ToString().CStr() : "Unknow", ice_session->GetSessionID());
 	}
+	else
+	{
+		ice_session->SetState(IceConnectionState::Closed);
+		logti("Agent [%s, %u] has closed", connected_candidate_pair != nullptr ? connected_candidate_pair->ToString().CStr() : "Unknow", ice_session->GetSessionID());
+	}
+
+	NotifyIceSessionStateChanged(ice_session);
 }
 
 bool IcePort::Send(session_id_t session_id, const std::shared_ptr<RtpPacket> &packet)
@@ -1028,10 +1016,8 @@ bool IcePort::SendStunBindingRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	// Store binding request transction
 	{
-		std::lock_guard<std::shared_mutex> brt_lock(_binding_requests_with_transaction_id_lock);
-
 		ov::String transaction_id_key((char *)(&transaction_id[0]), OV_STUN_TRANSACTION_ID_LENGTH);
-		_binding_requests_with_transaction_id.emplace(transaction_id_key, BindingRequestInfo(transaction_id_key, ice_session));
+		StoreIceSessionWithTransactionId(ice_session, transaction_id_key);
 
 		logtd("Send Binding Request to(%s) id(%s)", address_pair.ToString().CStr(), transaction_id_key.CStr());
 	}
@@ -1320,7 +1306,7 @@ bool IcePort::OnReceivedTurnRefreshRequest(const std::shared_ptr<ov::Socket> &re
 	return true;
 }
 
-void IcePort::NotifyIceSessionStateChanged(std::shared_ptr<IceSession> &session)
+void IcePort::NotifyIceSessionStateChanged(const std::shared_ptr<IceSession> &session)
 {
 	if (session->GetObserver() != nullptr)
 	{
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ice_session.h"
+#include "ice_session_table.h"
 #include "ice_port_observer.h"
 #include "ice_tcp_demultiplexer.h"
 #include "modules/ice/stun/stun_message.h"
@@ -34,6 +35,11 @@
 
 #define OV_ICE_PORT_PUBLIC_IP "${PublicIP}"
 
+// Sessions are distributed over the wheels by session id
+#define ICE_TIMER_WHEEL_COUNT 4
+// A binding request is discarded if the response does not arrive within this time
+#define ICE_BINDING_REQUEST_TIMEOUT_MS 3000
+
 class RtcIceCandidate;
 
 class IcePort : protected PhysicalPortObserver
@@ -43,7 +49,7 @@ public:
 	~IcePort() override;
 
 	bool CreateTurnServer(const ov::SocketAddress &address, ov::SocketType socket_type, int tcp_relay_worker_count);
-	bool CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count);
+	bool CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count, bool batched_egress = false);
 	bool Close();
 
 	ov::String GenerateUfrag();
@@ -76,7 +82,7 @@ protected:
 	void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) override;
 	//--------------------------------------------------------------------
 
-	void NotifyIceSessionStateChanged(std::shared_ptr<IceSession> &info);
+	void NotifyIceSessionStateChanged(const std::shared_ptr<IceSession> &info);
 
 private:
 	protected:
@@ -128,7 +134,7 @@ private:
 
 		bool IsExpired() const
 		{
-			if (ov::Clock::GetElapsedMiliSecondsFromNow(_requested_time) > 3000)
+			if (ov::Clock::GetElapsedMiliSecondsFromNow(_requested_time) > ICE_BINDING_REQUEST_TIMEOUT_MS)
 			{
 				return true;
 			}
@@ -157,7 +163,10 @@ private:
 	std::shared_ptr<IceSession> FindIceSessionWithTransactionId(const ov::String &transaction_id);
 	bool RemoveTransaction(const ov::String &transaction_id);
 
-	void CheckTimedOut();
+	// The timer of a session fires when the session may have expired, or it is disconnecting.
+	// If the session has been refreshed in the meantime, the timer is armed again for the remaining time.
+	void ArmSessionTimer(const std::shared_ptr<IceSession> &ice_session, int64_t after_ms);
+	void OnSessionTimer(const std::shared_ptr<IceSession> &ice_session);
 
 	void OnPacketReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair,
 						  GateInfo &packet_info, const std::shared_ptr<const ov::Data> &data);
@@ -209,27 +218,27 @@ private:
 	// Once binding is complete, there is no need because it can be found by destination ip & port.
 	// key: offer ufrag
 	std::shared_mutex _ice_sessions_with_ufrag_lock;
-	std::map<const ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
+	std::unordered_map<ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
 	
 	// Find IceSession with connected CandidatePair, used when receiving TURN channel data and application data
-	// key: SocketAddressPair
-	std::shared_mutex _ice_sessions_with_address_pair_lock;
-	std::map<ov::SocketAddressPair, std::shared_ptr<IceSession>> _ice_sessions_with_address_pair;
+	// key: SocketAddressPair (IceSessionTable has its own locks)
+	IceSessionTable _ice_sessions_with_address_pair;
 	
 	// Find IceSession with peer's session id, used for sending application data 
 	std::shared_mutex _ice_sessions_with_id_lock;
-	std::map<session_id_t, std::shared_ptr<IceSession>> _ice_seesions_with_id;
+	std::unordered_map<session_id_t, std::shared_ptr<IceSession>> _ice_seesions_with_id;
 
 	// Insert item when send stun binding request
 	// Remove item when receive stun binding response or timed out
 	// Request Transaction ID : Session
 	std::shared_mutex _binding_requests_with_transaction_id_lock;
-	std::map<ov::String, BindingRequestInfo> _binding_requests_with_transaction_id;
+	std::unordered_map<ov::String, BindingRequestInfo> _binding_requests_with_transaction_id;
 	
 	// Demultiplexer for data input through TCP
 	// remote's ID : Demultiplexer
 	std::shared_mutex _demultiplexers_lock;
 	std::map<int, std::shared_ptr<IceTcpDemultiplexer>> _demultiplexers;
 
-	ov::DelayQueue _timer{"ICETmout"};
+	// Session expiry and binding request timeouts (instead of scanning all the sessions periodically)
+	ov::TimerWheelPool _timer_wheels{"ICETmout", ICE_TIMER_WHEEL_COUNT};
 };
@@ -48,6 +48,18 @@ bool IceSession::IsExpired() const
 	return (std::chrono::system_clock::now() > _expire_time);
 }
 
+int64_t IceSession::GetRemainingTimeMs() const
+{
+	int64_t remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(_expire_time - std::chrono::system_clock::now()).count();
+
+	if (_lifetime_epoch_ms != 0)
+	{
+		remaining_ms = std::min(remaining_ms, static_cast<int64_t>(_lifetime_epoch_ms) - static_cast<int64_t>(ov::Clock::NowMSec()));
+	}
+
+	return std::max<int64_t>(remaining_ms, 0);
+}
+
 void IceSession::SetState(IceConnectionState state)
 {
 	_state = state;
@@ -31,6 +31,8 @@ public:
 	
 	void Refresh();
     bool IsExpired() const;
+	// Time until the session expires if it is not refreshed
+	int64_t GetRemainingTimeMs() const;
 
 	// State management
 	void SetState(IceConnectionState state);
@@ -0,0 +1,214 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ice_session_table.h"
+
+namespace
+{
+	struct FoundSessionCache
+	{
+		uint64_t table_id = 0;
+		uint64_t shard_version = 0;
+		size_t hash = 0;
+		ov::SocketAddressPair address_pair;
+		std::weak_ptr<IceSession> ice_session;
+	};
+
+	thread_local FoundSessionCache found_session_cache;
+}  // namespace
+
+IceSessionTable::IceSessionTable()
+{
+	static std::atomic<uint64_t> last_table_id{0};
+	_table_id = ++last_table_id;
+}
+
+bool IceSessionTable::Add(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session)
+{
+	auto hash = address_pair.Hash();
+	auto &shard = _shards[hash % ICE_SESSION_TABLE_SHARD_COUNT];
+
+	std::lock_guard<std::shared_mutex> lock_guard(shard.lock);
+
+	if (FindSlot(shard, hash, address_pair) >= 0)
+	{
+		return false;
+	}
+
+	// Keep the load factor under 0.5, so the probe sequences stay short
+	if ((shard.count + 1) * 2 > shard.slots.size())
+	{
+		Grow(shard);
+	}
+
+	auto mask = shard.slots.size() - 1;
+	auto index = GetSlotIndex(hash, mask);
+
+	while (shard.slots[index].used)
+	{
+		index = (index + 1) & mask;
+	}
+
+	auto &slot = shard.slots[index];
+	slot.used = true;
+	slot.hash = hash;
+	slot.address_pair = address_pair;
+	slot.ice_session = ice_session;
+
+	shard.count++;
+	shard.version.fetch_add(1, std::memory_order_release);
+	_count++;
+
+	return true;
+}
+
+bool IceSessionTable::Remove(const ov::SocketAddressPair &address_pair)
+{
+	auto hash = address_pair.Hash();
+	auto &shard = _shards[hash % ICE_SESSION_TABLE_SHARD_COUNT];
+
+	std::lock_guard<std::shared_mutex> lock_guard(shard.lock);
+
+	auto found_index = FindSlot(shard, hash, address_pair);
+	if (found_index < 0)
+	{
+		return false;
+	}
+
+	// Backward shift deletion: move the following entries of the probe sequence to the hole,
+	// so the lookups don't need tombstones
+	auto mask = shard.slots.size() - 1;
+	auto hole = static_cast<size_t>(found_index);
+	auto index = hole;
+
+	while (true)
+	{
+		index = (index + 1) & mask;
+
+		auto &slot = shard.slots[index];
+		if (slot.used == false)
+		{
+			break;
+		}
+
+		auto home = GetSlotIndex(slot.hash, mask);
+
+		// If the home of the entry is cyclically in (hole, index], the entry can't be moved to the hole
+		bool stays = (hole <= index) ? ((hole < home) && (home <= index)) : ((hole < home) || (home <= index));
+		if (stays)
+		{
+			continue;
+		}
+
+		shard.slots[hole] = std::move(slot);
+		hole = index;
+	}
+
+	shard.slots[hole] = Slot();
+
+	shard.count--;
+	shard.version.fetch_add(1, std::memory_order_release);
+	_count--;
+
+	return true;
+}
+
+std::shared_ptr<IceSession> IceSessionTable::Find(const ov::SocketAddressPair &address_pair) const
+{
+	auto hash = address_pair.Hash();
+	auto &shard = _shards[hash % ICE_SESSION_TABLE_SHARD_COUNT];
+
+	// Fast path: the same peer as the last lookup of this thread, and the shard is not changed since then
+	auto &cache = found_session_cache;
+	if ((cache.table_id == _table_id) &&
+		(cache.hash == hash) &&
+		(cache.shard_version == shard.version.load(std::memory_order_acquire)) &&
+		(cache.address_pair == address_pair))
+	{
+		auto ice_session = cache.ice_session.lock();
+		if (ice_session != nullptr)
+		{
+			return ice_session;
+		}
+	}
+
+	std::shared_lock<std::shared_mutex> lock_guard(shard.lock);
+
+	auto index = FindSlot(shard, hash, address_pair);
+	if (index < 0)
+	{
+		return nullptr;
+	}
+
+	auto ice_session = shard.slots[index].ice_session;
+
+	cache.table_id = _table_id;
+	cache.shard_version = shard.version.load(std::memory_order_relaxed);
+	cache.hash = hash;
+	cache.address_pair = address_pair;
+	cache.ice_session = ice_session;
+
+	return ice_session;
+}
+
+size_t IceSessionTable::GetCount() const
+{
+	return _count;
+}
+
+ssize_t IceSessionTable::FindSlot(const Shard &shard, size_t hash, const ov::SocketAddressPair &address_pair)
+{
+	if (shard.slots.empty())
+	{
+		return -1;
+	}
+
+	auto mask = shard.slots.size() - 1;
+	auto index = GetSlotIndex(hash, mask);
+
+	while (shard.slots[index].used)
+	{
+		const auto &slot = shard.slots[index];
+
+		if ((slot.hash == hash) && (slot.address_pair == address_pair))
+		{
+			return static_cast<ssize_t>(index);
+		}
+
+		index = (index + 1) & mask;
+	}
+
+	return -1;
+}
+
+void IceSessionTable::Grow(Shard &shard)
+{
+	auto capacity = shard.slots.empty() ? ICE_SESSION_TABLE_INITIAL_CAPACITY : (shard.slots.size() * 2);
+	auto mask = capacity - 1;
+
+	std::vector<Slot> slots(capacity);
+
+	for (auto &slot : shard.slots)
+	{
+		if (slot.used == false)
+		{
+			continue;
+		}
+
+		auto index = GetSlotIndex(slot.hash, mask);
+
+		while (slots[index].used)
+		{
+			index = (index + 1) & mask;
+		}
+
+		slots[index] = std::move(slot);
+	}
+
+	shard.slots = std::move(slots);
+}
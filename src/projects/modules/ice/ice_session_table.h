@@ -0,0 +1,79 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovsocket/socket_address_pair.h>
+
+#include <array>
+#include <atomic>
+#include <shared_mutex>
+#include <vector>
+
+#include "ice_session.h"
+
+// The shard is selected by the low bits of the hash, and the slot by the rest
+#define ICE_SESSION_TABLE_SHARD_BITS 6
+#define ICE_SESSION_TABLE_SHARD_COUNT (1 << ICE_SESSION_TABLE_SHARD_BITS)
+#define ICE_SESSION_TABLE_INITIAL_CAPACITY 16
+#define ICE_SESSION_TABLE_CACHE_LINE_SIZE 64
+
+// IceSessions of an IcePort keyed by the connected SocketAddressPair.
+// It is looked up for every RTP/RTCP/DTLS datagram, so:
+//
+// - The table is divided into shards that have their own lock, so the threads receiving the datagrams of
+//   different peers rarely touch the same lock
+// - Each shard is an open addressing (linear probing) table that keeps the hash of the pair,
+//   so most of the probes compare only the hash without following a pointer
+// - Each thread remembers the last session it found. While nothing is added to/removed from the shard,
+//   the session is returned without taking the lock (a burst of datagrams usually comes from the same peer)
+class IceSessionTable
+{
+public:
+	IceSessionTable();
+
+	// Returns false if the pair already exists
+	bool Add(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session);
+	bool Remove(const ov::SocketAddressPair &address_pair);
+	std::shared_ptr<IceSession> Find(const ov::SocketAddressPair &address_pair) const;
+
+	size_t GetCount() const;
+
+private:
+	struct Slot
+	{
+		bool used = false;
+		size_t hash = 0;
+		ov::SocketAddressPair address_pair;
+		std::shared_ptr<IceSession> ice_session;
+	};
+
+	struct alignas(ICE_SESSION_TABLE_CACHE_LINE_SIZE) Shard
+	{
+		mutable std::shared_mutex lock;
+		// Increased whenever a session is added to/removed from the shard, used to validate the cache of the threads
+		std::atomic<uint64_t> version{0};
+		std::vector<Slot> slots;
+		size_t count = 0;
+	};
+
+	static size_t GetSlotIndex(size_t hash, size_t mask)
+	{
+		return (hash >> ICE_SESSION_TABLE_SHARD_BITS) & mask;
+	}
+
+	// Returns the index of the slot, or -1 if not found (must be called with the lock of the shard)
+	static ssize_t FindSlot(const Shard &shard, size_t hash, const ov::SocketAddressPair &address_pair);
+	static void Grow(Shard &shard);
+
+	// To tell the tables apart in the cache of the threads
+	uint64_t _table_id = 0;
+
+	std::array<Shard, ICE_SESSION_TABLE_SHARD_COUNT> _shards;
+	std::atomic<size_t> _count{0};
+};
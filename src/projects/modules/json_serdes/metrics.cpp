@@ -50,6 +50,91 @@ namespace serdes
 		return value;
 	}
 
+	static Json::Value JsonFromHistogram(const mon::LatencyMetrics::Histogram &histogram)
+	{
+		Json::Value value;
+
+		auto count = histogram.GetCount();
+
+		SetInt64(value, "count", count);
+		SetInt64(value, "avgUs", (count > 0) ? (histogram.GetSumUs() / static_cast<int64_t>(count)) : 0);
+		SetInt64(value, "maxUs", histogram.GetMaxUs());
+
+		// Cumulative counts like Prometheus histograms: {"le": <upper bound (us)>, "count": <values <= le>}
+		Json::Value buckets(Json::ValueType::arrayValue);
+		uint64_t cumulative_count = 0;
+
+		for (size_t index = 0; index < mon::LatencyMetrics::NumberOfBuckets; index++)
+		{
+			Json::Value bucket;
+
+			cumulative_count += histogram.GetBucketCount(index);
+
+			if (index < mon::LatencyMetrics::BucketBoundsUs.size())
+			{
+				SetInt64(bucket, "le", mon::LatencyMetrics::BucketBoundsUs[index]);
+			}
+			else
+			{
+				SetString(bucket, "le", "+Inf", Optional::False);
+			}
+			SetInt64(bucket, "count", cumulative_count);
+
+			buckets.append(bucket);
+		}
+
+		value["buckets"] = buckets;
+
+		return value;
+	}
+
+	static Json::Value JsonFromLatencyMetrics(const mon::LatencyMetrics &metrics)
+	{
+		if (metrics.GetTotal().GetCount() == 0)
+		{
+			return Json::nullValue;
+		}
+
+		Json::Value value;
+		Json::Value &stages = value["stages"];
+
+		for (size_t index = 0; index < MediaTrace::NumberOfPoints; index++)
+		{
+			auto point = static_cast<MediaTrace::Point>(index);
+			auto &histogram = metrics.GetStage(point);
+
+			// Skip the stages that no packet has passed (e.g. bypassed tracks have no decode/filter/encode)
+			if (histogram.GetCount() == 0)
+			{
+				continue;
+			}
+
+			stages[MediaTrace::StringFromPoint(point)] = JsonFromHistogram(histogram);
+		}
+
+		value["total"] = JsonFromHistogram(metrics.GetTotal());
+
+		return value;
+	}
+
+	Json::Value JsonFromLatencyMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics)
+	{
+		Json::Value value = Json::nullValue;
+
+		for (size_t index = 0; index < static_cast<size_t>(PublisherType::NumberOfPublishers); index++)
+		{
+			auto type = static_cast<PublisherType>(index);
+			auto latency = JsonFromLatencyMetrics(metrics->GetLatencyMetrics(type));
+
+			if (latency.isNull() == false)
+			{
+				value[StringFromPublisherType(type).LowerCaseString().CStr()] = latency;
+			}
+		}
+
+		return value;
+	}
+
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics)
 	{
 		Json::Value value = JsonFromMetrics(metrics);
@@ -61,6 +146,25 @@ namespace serdes
 
 		SetTimeInterval(value, "requestTimeToOrigin", metrics->GetOriginConnectionTimeMSec());
 		SetTimeInterval(value, "responseTimeFromOrigin", metrics->GetOriginSubscribeTimeMSec());
+		SetTimeInterval(value, "firstFrameTimeFromOrigin", metrics->GetOriginFirstFrameTimeMSec());
+		SetInt64(value, "skippedPackets", metrics->GetSkippedPackets());
+
+		auto srtp_protected_packets = metrics->GetSrtpProtectedPackets();
+		if (srtp_protected_packets > 0)
+		{
+			Json::Value &srtp = value["srtp"];
+
+			SetInt64(srtp, "protectedPackets", srtp_protected_packets);
+			SetInt64(srtp, "protectedBytes", metrics->GetSrtpProtectedBytes());
+			SetInt64(srtp, "totalProtectTimeUs", metrics->GetSrtpProtectTimeNs() / 1000);
+			SetFloat(srtp, "avgProtectTimeUs", (metrics->GetSrtpProtectTimeNs() / 1000.0) / srtp_protected_packets);
+		}
+
+		auto latency = JsonFromLatencyMetrics(metrics);
+		if (latency.isNull() == false)
+		{
+			value["latency"] = latency;
+		}
 
 		return value;
 	}
@@ -87,4 +191,67 @@ namespace serdes
 
 		return value;
 	}
+
+	Json::Value JsonFromDatagramBatchStatistics(const ov::DatagramBatchStatistics &statistics)
+	{
+		Json::Value value;
+
+		const uint64_t flush_count = statistics.flush_count;
+		const uint64_t syscall_count = statistics.syscall_count;
+		const uint64_t packet_count = statistics.packet_count;
+
+		SetInt64(value, "flushCount", flush_count);
+		SetInt64(value, "syscalls", syscall_count);
+		SetInt64(value, "packets", packet_count);
+		SetInt64(value, "gsoPackets", statistics.gso_packet_count);
+		SetFloat(value, "packetsPerSyscall", (syscall_count > 0) ? static_cast<float>(packet_count) / syscall_count : 0.0f);
+		SetFloat(value, "packetsPerFlush", (flush_count > 0) ? static_cast<float>(packet_count) / flush_count : 0.0f);
+
+		return value;
+	}
+
+	Json::Value JsonFromDataPoolStatistics(const std::vector<ov::DataPoolStatistics> &statistics_list)
+	{
+		Json::Value response;
+		Json::Value classes(Json::ValueType::arrayValue);
+
+		uint64_t total_allocation_count = 0;
+		uint64_t total_hit_count = 0;
+		uint64_t total_reserved_bytes = 0;
+
+		for (const auto &statistics : statistics_list)
+		{
+			Json::Value value;
+
+			if (statistics.block_size > 0)
+			{
+				SetInt64(value, "blockSize", statistics.block_size);
+			}
+			else
+			{
+				SetString(value, "blockSize", "oversized", Optional::False);
+			}
+
+			SetInt64(value, "allocations", statistics.allocation_count);
+			SetInt64(value, "hits", statistics.hit_count);
+			SetFloat(value, "hitRate", (statistics.allocation_count > 0) ? static_cast<float>(statistics.hit_count) / statistics.allocation_count : 0.0f);
+			SetInt64(value, "inUse", statistics.in_use_count);
+			SetInt64(value, "cached", statistics.cached_count);
+			SetInt64(value, "reservedBytes", statistics.reserved_bytes);
+
+			classes.append(value);
+
+			total_allocation_count += statistics.allocation_count;
+			total_hit_count += statistics.hit_count;
+			total_reserved_bytes += statistics.reserved_bytes;
+		}
+
+		SetInt64(response, "allocations", total_allocation_count);
+		SetInt64(response, "hits", total_hit_count);
+		SetFloat(response, "hitRate", (total_allocation_count > 0) ? static_cast<float>(total_hit_count) / total_allocation_count : 0.0f);
+		SetInt64(response, "reservedBytes", total_reserved_bytes);
+		response["sizeClasses"] = classes;
+
+		return response;
+	}
 }  // namespace serdes
\ No newline at end of file
@@ -8,11 +8,16 @@
 //==============================================================================
 #pragma once
 
+#include <base/ovsocket/ovsocket.h>
 #include <monitoring/monitoring.h>
 
 namespace serdes
 {
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
+	// Returns the latency metrics for each publisher type, or null if no packet has been traced
+	Json::Value JsonFromLatencyMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
+	Json::Value JsonFromDatagramBatchStatistics(const ov::DatagramBatchStatistics &statistics);
+	Json::Value JsonFromDataPoolStatistics(const std::vector<ov::DataPoolStatistics> &statistics_list);
 }  // namespace serdes
\ No newline at end of file
@@ -0,0 +1,438 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <monitoring/monitoring.h>
+
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <condition_variable>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "base/info/managed_queue.h"
+#include "base/ovlibrary/ovlibrary.h"
+#include "managed_queue.h"
+
+// Default capacity of MpscManagedQueue (rounded up to a power of 2)
+// All slots are allocated up front, so a queue should be given a capacity that fits its use in the constructor
+#define MPSC_MANAGED_QUEUE_DEFAULT_CAPACITY 1024
+// The waiting time is measured once per N items to avoid calling now() for every item
+#define MPSC_MANAGED_QUEUE_WAITING_TIME_SAMPLING_INTERVAL 16
+// The number of per-producer counter slots (must be a power of 2)
+#define MPSC_MANAGED_QUEUE_COUNTER_SLOTS 16
+
+namespace ov
+{
+	// A bounded lock-free multi-producer/single-consumer variant of ManagedQueue (Based on Dmitry Vyukov's bounded queue)
+	//
+	// - Enqueue() never takes a lock unless the consumer is sleeping in Dequeue()
+	// - Dequeue()/Front()/IsEmpty()/Clear() are consumer APIs, and they are serialized with a lock that is not shared with producers
+	// - The metrics are collected in per-producer counters, and aggregated by the consumer
+	// - Unlike ManagedQueue, the capacity is bounded. If the queue is full, Enqueue() drops the item and returns false,
+	//   so a slow consumer never blocks the producers. The dropped items are counted in GetDropCount() and logged.
+	//   The producer must handle the false return, so use ManagedQueue where an item must never be lost
+	//
+	// It provides the same interface as ManagedQueue except Back()
+	template <typename T>
+	class MpscManagedQueue : public info::ManagedQueue
+	{
+	private:
+		const char* LOG_TAG = "ManagedQueue";
+
+		struct Slot
+		{
+			std::atomic<size_t> sequence{0};
+			// 0 if the waiting time of the item is not measured
+			int64_t enqueued_time_in_us = 0;
+			std::optional<T> data;
+		};
+
+		struct alignas(64) ProducerCounter
+		{
+			std::atomic<uint64_t> input_count{0};
+			std::atomic<uint64_t> drop_count{0};
+		};
+
+	public:
+		MpscManagedQueue()
+			: MpscManagedQueue(nullptr) {}
+
+		MpscManagedQueue(std::shared_ptr<info::ManagedQueue::URN> urn, size_t threshold = 0, size_t capacity = MPSC_MANAGED_QUEUE_DEFAULT_CAPACITY, int log_interval_in_msec = MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC)
+			: info::ManagedQueue(threshold),
+			  _stats_metric_interval(MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC),
+			  _log_interval(log_interval_in_msec)
+		{
+			size_t slot_count = 2;
+
+			while (slot_count < capacity)
+			{
+				slot_count <<= 1;
+			}
+
+			_slots = std::vector<Slot>(slot_count);
+			_mask = slot_count - 1;
+
+			for (size_t index = 0; index < slot_count; index++)
+			{
+				_slots[index].sequence.store(index, std::memory_order_relaxed);
+			}
+
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			_timer.Start();
+
+			// Register to the server metrics
+			// If the Unique id is duplicated or memory allocation failed, retry
+			while (true)
+			{
+				SetId(IssueUniqueQueueId());
+
+				if (MonitorInstance->GetServerMetrics()->OnQueueCreated(*this) == true)
+				{
+					break;
+				}
+			}
+		}
+
+		~MpscManagedQueue()
+		{
+			Clear();
+
+			// Unregister to the server metrics
+			MonitorInstance->GetServerMetrics()->OnQueueDeleted(*this);
+		}
+
+		void SetUrn(std::shared_ptr<info::ManagedQueue::URN> urn)
+		{
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this, true);
+		}
+
+		size_t GetCapacity() const
+		{
+			return _mask + 1;
+		}
+
+		// Returns false if the item is dropped because the queue is full (or stopped)
+		bool Enqueue(const T& item)
+		{
+			T copied_item = item;
+
+			return Enqueue(std::move(copied_item));
+		}
+
+		bool Enqueue(T&& item)
+		{
+			auto &counter = GetProducerCounter();
+
+			size_t position = _enqueue_position.load(std::memory_order_relaxed);
+			Slot* slot;
+
+			while (true)
+			{
+				slot = &(_slots[position & _mask]);
+
+				const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+				const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (diff == 0)
+				{
+					if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// The queue is full - drop the item instead of waiting for the consumer
+					if (_stop.load(std::memory_order_relaxed) == false)
+					{
+						counter.drop_count.fetch_add(1, std::memory_order_relaxed);
+					}
+
+					return false;
+				}
+				else
+				{
+					position = _enqueue_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			slot->enqueued_time_in_us =
+				((position % MPSC_MANAGED_QUEUE_WAITING_TIME_SAMPLING_INTERVAL) == 0)
+					? GetCurrentTimeInUs()
+					: 0;
+			slot->data.emplace(std::move(item));
+			slot->sequence.store(position + 1, std::memory_order_release);
+
+			counter.input_count.fetch_add(1, std::memory_order_relaxed);
+
+			// Wake up the consumer only if it is sleeping
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (_is_consumer_waiting.load(std::memory_order_relaxed))
+			{
+				auto lock_guard = std::lock_guard(_wait_mutex);
+				_condition.notify_all();
+			}
+
+			return true;
+		}
+
+		std::optional<T> Front(int timeout = Infinite)
+		{
+			return WaitAndConsume(timeout, false);
+		}
+
+		std::optional<T> Dequeue(int timeout = Infinite)
+		{
+			return WaitAndConsume(timeout, true);
+		}
+
+		bool IsEmpty() const
+		{
+			const size_t position = _dequeue_position.load(std::memory_order_relaxed);
+			const auto &slot = _slots[position & _mask];
+
+			return (slot.sequence.load(std::memory_order_acquire) != (position + 1));
+		}
+
+		// Cleared all items in the queue
+		void Clear()
+		{
+			auto lock_guard = std::lock_guard(_consumer_mutex);
+
+			while (TryConsume(true).has_value())
+			{
+			}
+
+			_size = 0;
+		}
+
+		size_t Size() const
+		{
+			const size_t enqueue_position = _enqueue_position.load(std::memory_order_relaxed);
+			const size_t dequeue_position = _dequeue_position.load(std::memory_order_relaxed);
+
+			return (enqueue_position > dequeue_position) ? (enqueue_position - dequeue_position) : 0;
+		}
+
+		void Stop()
+		{
+			auto lock_guard = std::lock_guard(_wait_mutex);
+
+			_stop = true;
+
+			_condition.notify_all();
+		}
+
+		bool IsStopped() const
+		{
+			return _stop;
+		}
+
+	protected:
+		static int64_t GetCurrentTimeInUs()
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		ProducerCounter& GetProducerCounter()
+		{
+			// Each producer thread uses its own counter slot to avoid sharing a cache line with other producers
+			static thread_local const size_t counter_index = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+			return _producer_counters[counter_index & (MPSC_MANAGED_QUEUE_COUNTER_SLOTS - 1)];
+		}
+
+		// _consumer_mutex must be held by the caller
+		std::optional<T> TryConsume(bool remove)
+		{
+			const size_t position = _dequeue_position.load(std::memory_order_relaxed);
+			auto &slot = _slots[position & _mask];
+
+			if (slot.sequence.load(std::memory_order_acquire) != (position + 1))
+			{
+				// Empty
+				return {};
+			}
+
+			if (remove == false)
+			{
+				return slot.data;
+			}
+
+			std::optional<T> value = std::move(slot.data);
+			slot.data.reset();
+
+			const auto enqueued_time_in_us = slot.enqueued_time_in_us;
+
+			_dequeue_position.store(position + 1, std::memory_order_relaxed);
+			slot.sequence.store(position + _mask + 1, std::memory_order_release);
+
+			_consumed_count++;
+
+			// Update statistics of waiting time (microseconds)
+			if (enqueued_time_in_us != 0)
+			{
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + (GetCurrentTimeInUs() - enqueued_time_in_us) * 0.1;
+			}
+
+			return value;
+		}
+
+		std::optional<T> WaitAndConsume(int timeout, bool remove)
+		{
+			if (_stop)
+			{
+				return {};	// Stop is requested
+			}
+
+			{
+				auto lock_guard = std::lock_guard(_consumer_mutex);
+
+				auto value = TryConsume(remove);
+
+				if (value.has_value())
+				{
+					UpdateMetrics(remove);
+					return value;
+				}
+			}
+
+			std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+			auto unique_lock = std::unique_lock(_wait_mutex);
+
+			_is_consumer_waiting.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
+				return ((IsEmpty() == false) || _stop);
+			});
+
+			_is_consumer_waiting.store(false, std::memory_order_relaxed);
+
+			unique_lock.unlock();
+
+			if (!result || _stop)
+			{
+				return {};	// timed out / Stop is requested
+			}
+
+			auto lock_guard = std::lock_guard(_consumer_mutex);
+
+			auto value = TryConsume(remove);
+			UpdateMetrics(remove);
+
+			return value;
+		}
+
+		// Aggregates the per-producer counters, and sends data to monitoring module
+		// _consumer_mutex must be held by the caller
+		void UpdateMetrics(bool dequeued)
+		{
+			_size = Size();
+
+			// Update the peak statistics
+			if (_peak < _size)
+			{
+				_peak = _size;
+			}
+
+			// Check the timer only occasionally
+			if (dequeued && ((++_metrics_check_count % MPSC_MANAGED_QUEUE_WAITING_TIME_SAMPLING_INTERVAL) != 0) && (_size > 0))
+			{
+				return;
+			}
+
+			if (_timer.IsElapsed(_stats_metric_interval) && _timer.Update())
+			{
+				uint64_t input_count = 0;
+				uint64_t drop_count = 0;
+
+				for (auto &counter : _producer_counters)
+				{
+					input_count += counter.input_count.load(std::memory_order_relaxed);
+					drop_count += counter.drop_count.load(std::memory_order_relaxed);
+				}
+
+				// Update statistics of message per second
+				_input_message_per_second = input_count - _last_input_count;
+				_output_message_per_second = _consumed_count - _last_consumed_count;
+				_last_input_count = input_count;
+				_last_consumed_count = _consumed_count;
+
+				if (drop_count > _drop_message_count)
+				{
+					logw(LOG_TAG, "[%u] %s is full (capacity: %zu), %" PRIu64 " items have been dropped", GetId(), ToString().CStr(), GetCapacity(), drop_count - _drop_message_count);
+					_drop_message_count = drop_count;
+				}
+
+				if ((_threshold > 0) && (_size >= _threshold))
+				{
+					_threshold_exceeded_time_in_us += _stats_metric_interval;
+
+					// Logging
+					_last_logging_time += _stats_metric_interval;
+					if (_last_logging_time >= _log_interval)
+					{
+						_last_logging_time = 0;
+						auto shared_lock = std::shared_lock(_name_mutex);
+						logw(LOG_TAG, "[%u] %s size has exceeded the threshold: queue: %zu, threshold: %zu, peak: %zu", GetId(), _urn->ToString().CStr(), _size, _threshold, _peak);
+					}
+				}
+				else
+				{
+					_threshold_exceeded_time_in_us = 0;
+				}
+
+				MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this);
+			}
+		}
+
+	private:
+		StopWatch _timer;
+
+		int _stats_metric_interval = 0;
+
+		int _log_interval = 0;
+		int64_t _last_logging_time = 0;
+
+		// Ring buffer
+		std::vector<Slot> _slots;
+		size_t _mask = 0;
+
+		alignas(64) std::atomic<size_t> _enqueue_position{0};
+		alignas(64) std::atomic<size_t> _dequeue_position{0};
+
+		// Per-producer counters
+		std::array<ProducerCounter, MPSC_MANAGED_QUEUE_COUNTER_SLOTS> _producer_counters;
+
+		// Consumer-side counters (protected by _consumer_mutex)
+		mutable std::mutex _consumer_mutex;
+		uint64_t _consumed_count = 0;
+		uint64_t _last_consumed_count = 0;
+		uint64_t _last_input_count = 0;
+		uint32_t _metrics_check_count = 0;
+
+		// Used only when the consumer needs to sleep
+		std::mutex _wait_mutex;
+		std::condition_variable _condition;
+		std::atomic<bool> _is_consumer_waiting{false};
+
+		// Stop flag
+		std::atomic<bool> _stop{false};
+	};
+}  // namespace ov
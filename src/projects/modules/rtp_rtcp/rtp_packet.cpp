@@ -492,6 +492,17 @@ uint8_t* RtpPacket::Extension(uint8_t id) const
 	return &_buffer[offset];
 }
 
+off_t RtpPacket::ExtensionOffset(uint8_t id) const
+{
+	auto it = _extension_buffer_offset.find(id);
+	if (it == _extension_buffer_offset.end())
+	{
+		return -1;
+	}
+
+	return it->second;
+}
+
 std::chrono::system_clock::time_point RtpPacket::GetCreatedTime()
 {
 	return _created_time;
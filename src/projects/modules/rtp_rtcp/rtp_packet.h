@@ -85,6 +85,8 @@ public:
 	uint8_t*	Header() const;
 	uint8_t*	Payload() const;
 	uint8_t* 	Extension(uint8_t id) const;
+	// Offset of the extension from the beginning of the header, -1 if there is no such extension
+	off_t		ExtensionOffset(uint8_t id) const;
 
 	// Data
 	std::shared_ptr<ov::Data> GetData() const;
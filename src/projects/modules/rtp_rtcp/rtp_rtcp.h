@@ -35,6 +35,9 @@ public:
 	bool Stop() override;
 
 	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// Sends rtp_data instead of packet->GetData(). rtp_data is a serialized copy of the packet that the caller has modified (e.g. sequence number)
+	// and packet is only used for statistics, so the packet shared by several sessions does not need to be copied.
+	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet, const std::shared_ptr<ov::Data> &rtp_data);
 	bool SendPLI(uint32_t media_ssrc);
 	bool SendFIR(uint32_t media_ssrc);
 
@@ -8,18 +8,17 @@
 namespace mon
 {
 #define THROUGHPUT_MEASURE_INTERVAL 1
+#define MON_TIME_UPDATE_INTERVAL_MS 10
 
 	CommonMetrics::CommonMetrics()
 	{
-		_total_bytes_in = 0;
-		_total_bytes_out = 0;
 		_total_connections = 0;
 		_max_total_connections = 0;
 
 		_avg_throughtput_in = 0;
 		_max_throughtput_in = 0;
 		_last_throughtput_in = 0;
-		_last_total_bytes_out = 0;
+		_last_total_bytes_in = 0;
 
 		_avg_throughtput_out = 0;
 		_max_throughtput_out = 0;
@@ -34,7 +33,6 @@ namespace mon
 
 		for (int i = 0; i < static_cast<int8_t>(PublisherType::NumberOfPublishers); i++)
 		{
-			_publisher_metrics[i]._bytes_out = 0;
 			_publisher_metrics[i]._connections = 0;
 		}
 		_created_time = std::chrono::system_clock::now();
@@ -88,11 +86,18 @@ namespace mon
 
 	uint64_t CommonMetrics::GetTotalBytesIn() const
 	{
-		return _total_bytes_in;
+		return _traffic_counters.Get(BytesInCounterIndex);
 	}
 	uint64_t CommonMetrics::GetTotalBytesOut() const
 	{
-		return _total_bytes_out;
+		uint64_t total_bytes_out = 0;
+
+		for (size_t i = 0; i < static_cast<size_t>(PublisherType::NumberOfPublishers); i++)
+		{
+			total_bytes_out += _traffic_counters.Get(i);
+		}
+
+		return total_bytes_out;
 	}
 
 	uint64_t CommonMetrics::GetAvgThroughputIn() const
@@ -151,7 +156,7 @@ namespace mon
 
 	uint64_t CommonMetrics::GetBytesOut(PublisherType type) const
 	{
-		return _publisher_metrics[static_cast<int8_t>(type)]._bytes_out;
+		return _traffic_counters.Get(static_cast<size_t>(type));
 	}
 	uint64_t CommonMetrics::GetConnections(PublisherType type) const
 	{
@@ -160,14 +165,16 @@ namespace mon
 
 	void CommonMetrics::IncreaseBytesIn(uint64_t value)
 	{
-		_total_bytes_in += value;
-		_last_recv_time = std::chrono::system_clock::now();
+		_traffic_counters.Add(BytesInCounterIndex, value);
+
+		auto now = std::chrono::system_clock::now();
+		UpdateTime(_last_recv_time, now);
 
 		// If there are no clients of the publisher, output throughput is not calculated.
 		// So, In/Oout throughput calculations are handled here.
 		UpdateThroughput();
 
-		UpdateDate();
+		UpdateTime(_last_updated_time, now);
 	}
 
 	void CommonMetrics::IncreaseBytesOut(PublisherType type, uint64_t value)
@@ -177,11 +184,11 @@ namespace mon
 			return;
 		}
 
-		_publisher_metrics[static_cast<int8_t>(type)]._bytes_out += value;
-		_total_bytes_out += value;
-		_last_sent_time = std::chrono::system_clock::now();
+		_traffic_counters.Add(static_cast<size_t>(type), value);
 
-		UpdateDate();
+		auto now = std::chrono::system_clock::now();
+		UpdateTime(_last_sent_time, now);
+		UpdateTime(_last_updated_time, now);
 	}
 
 	void CommonMetrics::OnSessionConnected(PublisherType type)
@@ -219,6 +226,14 @@ namespace mon
 		_last_updated_time = std::chrono::system_clock::now();
 	}
 
+	void CommonMetrics::UpdateTime(std::chrono::system_clock::time_point &time, const std::chrono::system_clock::time_point &now)
+	{
+		if ((now - time) >= std::chrono::milliseconds(MON_TIME_UPDATE_INTERVAL_MS))
+		{
+			time = now;
+		}
+	}
+
 	void CommonMetrics::UpdateThroughput()
 	{
 		auto throughput_measure_time = std::chrono::system_clock::now();
@@ -226,27 +241,30 @@ namespace mon
 		{
 			_last_throughput_measure_time = throughput_measure_time;
 
+			auto total_bytes_in = GetTotalBytesIn();
+			auto total_bytes_out = GetTotalBytesOut();
+
 			// Calculate last second throughput of provider
-			_last_throughtput_in = (_total_bytes_in.load() - _last_total_bytes_in.load());
+			_last_throughtput_in = (total_bytes_in - _last_total_bytes_in.load());
 
 			// Calculate average throughput of provider
-			_avg_throughtput_in = (_total_bytes_in.load() - _last_total_bytes_in.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
+			_avg_throughtput_in = (total_bytes_in - _last_total_bytes_in.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
 			if (_avg_throughtput_in.load() > _max_throughtput_in.load())
 			{
 				_max_throughtput_in.store(_avg_throughtput_in);
 			}
-			_last_total_bytes_in.store(_total_bytes_in);
+			_last_total_bytes_in.store(total_bytes_in);
 
 			// Calculate last second throughput of publisher
-			_last_throughtput_out = (_total_bytes_out.load() - _last_total_bytes_out.load());
+			_last_throughtput_out = (total_bytes_out - _last_total_bytes_out.load());
 
 			// Calculate average throughput of publisher
-			_avg_throughtput_out = (_total_bytes_out.load() - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
+			_avg_throughtput_out = (total_bytes_out - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
 			if (_avg_throughtput_out.load() > _max_throughtput_out.load())
 			{
 				_max_throughtput_out.store(_avg_throughtput_out);
 			}
-			_last_total_bytes_out.store(_total_bytes_out);
+			_last_total_bytes_out.store(total_bytes_out);
 		}
 	}
 }  // namespace mon
\ No newline at end of file
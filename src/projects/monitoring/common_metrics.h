@@ -7,6 +7,7 @@
 #include "base/common_types.h"
 #include "base/info/info.h"
 #include "base/info/stream.h"
+#include "sharded_counters.h"
 
 namespace mon
 {
@@ -49,15 +50,16 @@ namespace mon
 		// Renew last updated time
 		void UpdateDate();
 		void UpdateThroughput();
+		// Bytes are counted for every packet by many threads, so the times are renewed only if they are older than MON_TIME_UPDATE_INTERVAL_MS.
+		// This avoids that all the threads write the same cache line for every packet.
+		void UpdateTime(std::chrono::system_clock::time_point &time, const std::chrono::system_clock::time_point &now);
 
 		std::chrono::system_clock::time_point _created_time;
 		std::chrono::system_clock::time_point _last_updated_time;
 
-		// From Provider
-		std::atomic<uint64_t> _total_bytes_in;
-
-		// From Publishers
-		std::atomic<uint64_t> _total_bytes_out;
+		// Bytes out of each publisher, and bytes in from provider
+		static constexpr size_t BytesInCounterIndex = static_cast<size_t>(PublisherType::NumberOfPublishers);
+		ShardedCounters<BytesInCounterIndex + 1> _traffic_counters;
 
 		std::atomic<uint32_t> _total_connections;
 		std::atomic<uint32_t> _max_total_connections;
@@ -87,7 +89,6 @@ namespace mon
 		class PublisherMetrics
 		{
 		public:
-			std::atomic<uint64_t> _bytes_out;
 			std::atomic<uint32_t> _connections;
 		};
 
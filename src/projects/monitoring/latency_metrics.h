@@ -0,0 +1,128 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_trace.h>
+
+#include <array>
+#include <atomic>
+
+namespace mon
+{
+	// Histograms of the time that the sampled packets spent in each stage of the pipeline (see MediaTrace)
+	class LatencyMetrics
+	{
+	public:
+		// Upper bounds of the buckets in microseconds. The last bucket has no upper bound.
+		static constexpr std::array<int64_t, 13> BucketBoundsUs = {
+			100, 250, 500,
+			1000, 2500, 5000,
+			10000, 25000, 50000,
+			100000, 250000, 500000,
+			1000000};
+		static constexpr size_t NumberOfBuckets = BucketBoundsUs.size() + 1;
+
+		class Histogram
+		{
+		public:
+			void Record(int64_t value_us)
+			{
+				size_t index = 0;
+				while ((index < BucketBoundsUs.size()) && (value_us > BucketBoundsUs[index]))
+				{
+					index++;
+				}
+
+				_buckets[index].fetch_add(1, std::memory_order_relaxed);
+				_count.fetch_add(1, std::memory_order_relaxed);
+				_sum_us.fetch_add(value_us, std::memory_order_relaxed);
+
+				auto max_us = _max_us.load(std::memory_order_relaxed);
+				while ((value_us > max_us) && (_max_us.compare_exchange_weak(max_us, value_us, std::memory_order_relaxed) == false))
+				{
+				}
+			}
+
+			uint64_t GetCount() const
+			{
+				return _count.load(std::memory_order_relaxed);
+			}
+
+			int64_t GetSumUs() const
+			{
+				return _sum_us.load(std::memory_order_relaxed);
+			}
+
+			int64_t GetMaxUs() const
+			{
+				return _max_us.load(std::memory_order_relaxed);
+			}
+
+			// The number of values in the bucket (not cumulative)
+			uint64_t GetBucketCount(size_t index) const
+			{
+				return _buckets[index].load(std::memory_order_relaxed);
+			}
+
+		private:
+			std::array<std::atomic<uint64_t>, NumberOfBuckets> _buckets{};
+			std::atomic<uint64_t> _count{0};
+			std::atomic<int64_t> _sum_us{0};
+			std::atomic<int64_t> _max_us{0};
+		};
+
+		// Records the time between the points that the packet has passed.
+		// A stage is recorded in the histogram of the point where it ends.
+		void Record(const MediaTrace &trace)
+		{
+			int64_t first_timestamp = 0;
+			int64_t last_timestamp = 0;
+
+			for (size_t index = 0; index < MediaTrace::NumberOfPoints; index++)
+			{
+				auto timestamp = trace.GetTimestamp(static_cast<MediaTrace::Point>(index));
+				if (timestamp == 0)
+				{
+					// The packet has not passed this point (e.g. bypassed track)
+					continue;
+				}
+
+				if (last_timestamp != 0)
+				{
+					_stages[index].Record(timestamp - last_timestamp);
+				}
+				else
+				{
+					first_timestamp = timestamp;
+				}
+
+				last_timestamp = timestamp;
+			}
+
+			if (last_timestamp != first_timestamp)
+			{
+				_total.Record(last_timestamp - first_timestamp);
+			}
+		}
+
+		const Histogram &GetStage(MediaTrace::Point point) const
+		{
+			return _stages[static_cast<size_t>(point)];
+		}
+
+		const Histogram &GetTotal() const
+		{
+			return _total;
+		}
+
+	private:
+		std::array<Histogram, MediaTrace::NumberOfPoints> _stages;
+		Histogram _total;
+	};
+}  // namespace mon
@@ -0,0 +1,67 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <array>
+#include <atomic>
+
+// The number of shards of a counter. Threads are distributed over the shards in a round-robin manner.
+#define MON_COUNTER_SHARD_COUNT 8
+#define MON_CACHE_LINE_SIZE 64
+
+namespace mon
+{
+	// A group of counters that are increased by many threads (e.g. bytes sent by every session).
+	// Each thread increases the counters of its own shard, which is on a separate cache line,
+	// so the threads don't contend with each other. The shards are summed only when the value is read.
+	template <size_t Tcount>
+	class ShardedCounters
+	{
+	public:
+		void Add(size_t index, uint64_t value)
+		{
+			_shards[GetShardIndex()].values[index].fetch_add(value, std::memory_order_relaxed);
+		}
+
+		// A shard may wrap around if the value is added by another thread, but the sum is still correct
+		void Subtract(size_t index, uint64_t value)
+		{
+			_shards[GetShardIndex()].values[index].fetch_sub(value, std::memory_order_relaxed);
+		}
+
+		// Sums all the shards
+		uint64_t Get(size_t index) const
+		{
+			uint64_t sum = 0;
+
+			for (const auto &shard : _shards)
+			{
+				sum += shard.values[index].load(std::memory_order_relaxed);
+			}
+
+			return sum;
+		}
+
+	private:
+		struct alignas(MON_CACHE_LINE_SIZE) Shard
+		{
+			std::array<std::atomic<uint64_t>, Tcount> values{};
+		};
+
+		static size_t GetShardIndex()
+		{
+			static std::atomic<size_t> next_index{0};
+			thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed) % MON_COUNTER_SHARD_COUNT;
+
+			return index;
+		}
+
+		std::array<Shard, MON_COUNTER_SHARD_COUNT> _shards;
+	};
+}  // namespace mon
@@ -17,8 +17,9 @@ namespace mon
 		if(GetSourceType() == StreamSourceType::Ovt || GetSourceType() == StreamSourceType::RtspPull)
 		{
 			out_str.AppendFormat("\n\tElapsed time to connect to origin server : %llu ms\n"
-									"\tElapsed time to subscribe to origin server : %llu ms\n",
-									GetOriginConnectionTimeMSec(), GetOriginSubscribeTimeMSec());
+									"\tElapsed time to subscribe to origin server : %llu ms\n"
+									"\tElapsed time to receive the first frame from origin server : %llu ms\n",
+									GetOriginConnectionTimeMSec(), GetOriginSubscribeTimeMSec(), GetOriginFirstFrameTimeMSec());
 		}
 		out_str.Append("\n");
 		out_str.Append(CommonMetrics::GetInfoString());
@@ -50,6 +51,10 @@ namespace mon
 	{
 		return _subscribe_time_from_origin_msec.load();
 	}
+	int64_t StreamMetrics::GetOriginFirstFrameTimeMSec() const
+	{
+		return _first_frame_time_from_origin_msec.load();
+	}
 
 	// Setter
 	void StreamMetrics::SetOriginConnectionTimeMSec(int64_t value)
@@ -62,6 +67,11 @@ namespace mon
 		_subscribe_time_from_origin_msec = value;
 		UpdateDate();
 	}
+	void StreamMetrics::SetOriginFirstFrameTimeMSec(int64_t value)
+	{
+		_first_frame_time_from_origin_msec = value;
+		UpdateDate();
+	}
 
 	void StreamMetrics::IncreaseBytesIn(uint64_t value)
 	{
@@ -79,6 +89,81 @@ namespace mon
 		}
 	}
 
+	void StreamMetrics::OnLatencyTraced(PublisherType type, const MediaTrace &trace)
+	{
+		_latency_metrics[static_cast<size_t>(type)].Record(trace);
+
+		// If this stream is child then send event to parent
+		auto origin_stream_info = GetLinkedInputStream();
+		if(origin_stream_info != nullptr)
+		{
+			auto origin_stream_metric = _app_metrics->GetStreamMetrics(*origin_stream_info);
+			if(origin_stream_metric != nullptr)
+			{
+				origin_stream_metric->OnLatencyTraced(type, trace);
+			}
+		}
+	}
+
+	const LatencyMetrics &StreamMetrics::GetLatencyMetrics(PublisherType type) const
+	{
+		return _latency_metrics[static_cast<size_t>(type)];
+	}
+
+	void StreamMetrics::OnPacketsSkipped(uint64_t count)
+	{
+		_skipped_packets.fetch_add(count, std::memory_order_relaxed);
+
+		// If this stream is child then send event to parent
+		auto origin_stream_info = GetLinkedInputStream();
+		if(origin_stream_info != nullptr)
+		{
+			auto origin_stream_metric = _app_metrics->GetStreamMetrics(*origin_stream_info);
+			if(origin_stream_metric != nullptr)
+			{
+				origin_stream_metric->OnPacketsSkipped(count);
+			}
+		}
+	}
+
+	uint64_t StreamMetrics::GetSkippedPackets() const
+	{
+		return _skipped_packets.load(std::memory_order_relaxed);
+	}
+
+	void StreamMetrics::OnSrtpProtected(uint64_t packets, uint64_t bytes, uint64_t time_ns)
+	{
+		_srtp_protected_packets.fetch_add(packets, std::memory_order_relaxed);
+		_srtp_protected_bytes.fetch_add(bytes, std::memory_order_relaxed);
+		_srtp_protect_time_ns.fetch_add(time_ns, std::memory_order_relaxed);
+
+		// If this stream is child then send event to parent
+		auto origin_stream_info = GetLinkedInputStream();
+		if(origin_stream_info != nullptr)
+		{
+			auto origin_stream_metric = _app_metrics->GetStreamMetrics(*origin_stream_info);
+			if(origin_stream_metric != nullptr)
+			{
+				origin_stream_metric->OnSrtpProtected(packets, bytes, time_ns);
+			}
+		}
+	}
+
+	uint64_t StreamMetrics::GetSrtpProtectedPackets() const
+	{
+		return _srtp_protected_packets.load(std::memory_order_relaxed);
+	}
+
+	uint64_t StreamMetrics::GetSrtpProtectedBytes() const
+	{
+		return _srtp_protected_bytes.load(std::memory_order_relaxed);
+	}
+
+	uint64_t StreamMetrics::GetSrtpProtectTimeNs() const
+	{
+		return _srtp_protect_time_ns.load(std::memory_order_relaxed);
+	}
+
 	void StreamMetrics::IncreaseBytesOut(PublisherType type, uint64_t value) 
 	{
 		CommonMetrics::IncreaseBytesOut(type, value);
@@ -9,6 +9,7 @@
 #include "base/info/info.h"
 #include "base/info/stream.h"
 #include "common_metrics.h"
+#include "latency_metrics.h"
 
 namespace mon
 {
@@ -22,6 +23,7 @@ namespace mon
 		{
 			_connection_time_to_origin_msec = 0;
 			_subscribe_time_from_origin_msec = 0;
+			_first_frame_time_from_origin_msec = 0;
 			logd("DEBUG", "StreamMetric (%s / %s) Created", GetName().CStr(), GetUUID().CStr());
 		}
 
@@ -44,8 +46,11 @@ namespace mon
 
 		int64_t GetOriginConnectionTimeMSec() const;
 		int64_t GetOriginSubscribeTimeMSec() const;
+		// Elapsed time from the start of the pull to the first frame received from the origin (time-to-first-frame)
+		int64_t GetOriginFirstFrameTimeMSec() const;
 		void SetOriginConnectionTimeMSec(int64_t value);
 		void SetOriginSubscribeTimeMSec(int64_t value);
+		void SetOriginFirstFrameTimeMSec(int64_t value);
 
 		// Overriding from CommonMetrics 
 		void IncreaseBytesIn(uint64_t value) override;
@@ -53,14 +58,38 @@ namespace mon
 		void OnSessionConnected(PublisherType type) override;
 		void OnSessionDisconnected(PublisherType type) override;
 		void OnSessionsDisconnected(PublisherType type, uint64_t number_of_sessions) override;
+
+		// Called when a sampled packet has been sent by a publisher
+		// Every publisher sends the same packet, so the histograms are kept for each publisher type
+		void OnLatencyTraced(PublisherType type, const MediaTrace &trace);
+		const LatencyMetrics &GetLatencyMetrics(PublisherType type) const;
+
+		// Called when a StreamWorker of a publisher was too slow and skipped the packets of the stream
+		void OnPacketsSkipped(uint64_t count);
+		uint64_t GetSkippedPackets() const;
+
+		// Called by the WebRTC sessions with the SRTP encryption cost since the last call
+		void OnSrtpProtected(uint64_t packets, uint64_t bytes, uint64_t time_ns);
+		uint64_t GetSrtpProtectedPackets() const;
+		uint64_t GetSrtpProtectedBytes() const;
+		uint64_t GetSrtpProtectTimeNs() const;
 	private:
 		// Related to origin, From Provider
 		std::atomic<int64_t> _connection_time_to_origin_msec = 0;
 		std::atomic<int64_t> _subscribe_time_from_origin_msec = 0;
+		std::atomic<int64_t> _first_frame_time_from_origin_msec = 0;
 
 		// If this stream is from Provider(input stream) it has multiple output streams
 		std::vector<std::shared_ptr<StreamMetrics>> _output_stream_metrics;
 
 		std::shared_ptr<ApplicationMetrics>	_app_metrics;
+
+		std::array<LatencyMetrics, static_cast<size_t>(PublisherType::NumberOfPublishers)> _latency_metrics;
+
+		std::atomic<uint64_t> _skipped_packets = 0;
+
+		std::atomic<uint64_t> _srtp_protected_packets = 0;
+		std::atomic<uint64_t> _srtp_protected_bytes = 0;
+		std::atomic<uint64_t> _srtp_protect_time_ns = 0;
 	};
 }
\ No newline at end of file
@@ -63,7 +63,7 @@ namespace ocst
 					auto &app_info = app->app_info;
 
 					// Delete dynamic application if there are no streams for 60 seconds
-					if (app_info.IsDynamicApp() == true && app->IsUnusedFor(60) == true)
+					if (app_info.IsDynamicApp() == true && app->IsUnusedFor(60) == true && IsPullingStreamInApplication(app_info.GetName()) == false)
 					{
 						logti("There are no streams in the dynamic application for 60 seconds. Delete the application: %s", app_info.GetName().CStr());
 						std::lock_guard<std::recursive_mutex> lock(_application_mutex);
@@ -613,6 +613,110 @@ namespace ocst
 		return OrchestratorInternal::GetUrlListForLocation(vhost_app_name, host_name, stream_name, url_list, nullptr, nullptr);
 	}
 
+	bool Orchestrator::PullingStream::Wait()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		condition.wait(lock, [this]() -> bool {
+			return completed;
+		});
+
+		return result;
+	}
+
+	void Orchestrator::PullingStream::Complete(bool result)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			this->result = result;
+			completed = true;
+		}
+
+		condition.notify_all();
+	}
+
+	bool Orchestrator::BeginPullingStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, std::shared_ptr<PullingStream> *pulling_stream)
+	{
+		auto key = ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream_name.CStr());
+
+		std::lock_guard<std::mutex> lock(_pulling_stream_map_mutex);
+
+		auto item = _pulling_stream_map.find(key);
+		if (item != _pulling_stream_map.end())
+		{
+			*pulling_stream = item->second;
+			return false;
+		}
+
+		*pulling_stream = std::make_shared<PullingStream>(vhost_app_name);
+		_pulling_stream_map[key] = *pulling_stream;
+
+		return true;
+	}
+
+	void Orchestrator::EndPullingStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, const std::shared_ptr<PullingStream> &pulling_stream, bool result)
+	{
+		auto key = ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream_name.CStr());
+
+		{
+			std::lock_guard<std::mutex> lock(_pulling_stream_map_mutex);
+
+			_pulling_stream_map.erase(key);
+		}
+
+		pulling_stream->Complete(result);
+	}
+
+	bool Orchestrator::IsPullingStreamInApplication(const info::VHostAppName &vhost_app_name)
+	{
+		std::lock_guard<std::mutex> lock(_pulling_stream_map_mutex);
+
+		for (const auto &item : _pulling_stream_map)
+		{
+			if (item.second->vhost_app_name == vhost_app_name)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	std::shared_ptr<pvd::Stream> Orchestrator::PullStreamFromProvider(
+		std::unique_lock<std::recursive_mutex> &app_lock,
+		const std::shared_ptr<PullProviderModuleInterface> &provider_module,
+		const std::shared_ptr<const ov::Url> &request_from,
+		const info::Application &app_info, const ov::String &stream_name,
+		const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties)
+	{
+		app_lock.unlock();
+		auto stream = provider_module->PullStream(request_from, app_info, stream_name, url_list, offset, properties);
+		app_lock.lock();
+
+		if (stream == nullptr)
+		{
+			return nullptr;
+		}
+
+		bool is_app_deleted = false;
+		{
+			auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
+
+			auto &current_app_info = OrchestratorInternal::GetApplicationInfo(app_info.GetName());
+			is_app_deleted = (current_app_info.IsValid() == false) || (current_app_info.GetId() != app_info.GetId());
+		}
+
+		if (is_app_deleted)
+		{
+			logtw("The application was deleted while pulling the stream: [%s/%s]", app_info.GetName().CStr(), stream_name.CStr());
+			provider_module->StopStream(app_info, stream);
+			return nullptr;
+		}
+
+		return stream;
+	}
+
 	bool Orchestrator::RequestPullStreamWithUrls(
 		const std::shared_ptr<const ov::Url> &request_from,
 		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
@@ -624,8 +728,26 @@ namespace ocst
 			return false;
 		}
 
-		// Any applications MUST NOT be deleted during this function
-		std::lock_guard<std::recursive_mutex> app_lock(_application_mutex);
+		std::shared_ptr<PullingStream> pulling_stream;
+		if (BeginPullingStream(vhost_app_name, stream_name, &pulling_stream) == false)
+		{
+			logti("Waiting for the stream to be pulled by the previous request: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
+			return pulling_stream->Wait();
+		}
+
+		auto result = RequestPullStreamWithUrlsInternal(request_from, vhost_app_name, stream_name, url_list, offset, properties);
+		EndPullingStream(vhost_app_name, stream_name, pulling_stream, result);
+
+		return result;
+	}
+
+	bool Orchestrator::RequestPullStreamWithUrlsInternal(
+		const std::shared_ptr<const ov::Url> &request_from,
+		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+		const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties)
+	{
+		// Any applications MUST NOT be deleted while the application is prepared
+		std::unique_lock<std::recursive_mutex> app_lock(_application_mutex);
 
 		auto url = url_list[0];
 		auto parsed_url = ov::Url::Parse(url);
@@ -688,7 +810,7 @@ namespace ocst
 				  vhost_app_name.CStr(), stream_name.CStr(),
 				  GetModuleTypeName(provider_module->GetModuleType()).CStr());
 
-			auto stream = provider_module->PullStream(request_from, app_info, stream_name, url_list, offset, properties);
+			auto stream = PullStreamFromProvider(app_lock, provider_module, request_from, app_info, stream_name, url_list, offset, properties);
 
 			if (stream != nullptr)
 			{
@@ -719,8 +841,26 @@ namespace ocst
 		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
 		off_t offset)
 	{
-		// Any applications MUST NOT be deleted during this function
-		std::lock_guard<std::recursive_mutex> app_lock(_application_mutex);
+		std::shared_ptr<PullingStream> pulling_stream;
+		if (BeginPullingStream(vhost_app_name, stream_name, &pulling_stream) == false)
+		{
+			logti("Waiting for the stream to be pulled by the previous request: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
+			return pulling_stream->Wait();
+		}
+
+		auto result = RequestPullStreamWithOriginMapInternal(request_from, vhost_app_name, stream_name, offset);
+		EndPullingStream(vhost_app_name, stream_name, pulling_stream, result);
+
+		return result;
+	}
+
+	bool Orchestrator::RequestPullStreamWithOriginMapInternal(
+		const std::shared_ptr<const ov::Url> &request_from,
+		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+		off_t offset)
+	{
+		// Any applications MUST NOT be deleted while the application is prepared
+		std::unique_lock<std::recursive_mutex> app_lock(_application_mutex);
 
 		std::shared_ptr<PullProviderModuleInterface> provider_module;
 		auto app_info = info::Application::GetInvalidApplication();
@@ -786,6 +926,14 @@ namespace ocst
 					logte("Could not create application for the stream: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
 					return false;
 				}
+
+				app_info = OrchestratorInternal::GetApplicationInfo(vhost_app_name);
+				if (app_info.IsValid() == false)
+				{
+					// MUST NOT HAPPEN
+					logte("Could not find created application for the stream: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
+					return false;
+				}
 			}
 
 			if (matched_origin->forward_query_params && request_from->HasQueryString())
@@ -818,7 +966,7 @@ namespace ocst
 		properties->EnableRelay(matched_origin->relay);
 		properties->EnableFromOriginMapStore(false);
 
-		auto stream = provider_module->PullStream(request_from, app_info, stream_name, url_list, offset, properties);
+		auto stream = PullStreamFromProvider(app_lock, provider_module, request_from, app_info, stream_name, url_list, offset, properties);
 
 		if (stream != nullptr)
 		{
@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include <condition_variable>
+
 #include "orchestrator_internal.h"
 
 namespace ocst
@@ -199,7 +201,56 @@ namespace ocst
 		// The application should not be deleted during the pull stream. Since the _virtual_host_map_mutex is widely used, locking the pull stream to this mutex reduces overall system performance. Therefore, a separate mutex is used.
 		std::recursive_mutex _application_mutex;
 
+		// A pull request in progress. When a popular stream goes live, a lot of requests for the stream come at once,
+		// so the requests that come later wait for the result of the first one instead of connecting to the origin again.
+		struct PullingStream
+		{
+			PullingStream(const info::VHostAppName &vhost_app_name)
+				: vhost_app_name(vhost_app_name)
+			{
+			}
+
+			// Returns the result of the first request
+			bool Wait();
+			void Complete(bool result);
+
+			const info::VHostAppName vhost_app_name;
+
+			std::mutex mutex;
+			std::condition_variable condition;
+			bool completed = false;
+			bool result = false;
+		};
+
+		std::mutex _pulling_stream_map_mutex;
+		// key: <vhost_app_name>/<stream_name>
+		std::unordered_map<ov::String, std::shared_ptr<PullingStream>> _pulling_stream_map;
+
 	private:
 		void DeleteUnusedDynamicApplications();
+
+		// Returns true if this request is the first one for the stream. Otherwise, returns false with the request in progress
+		bool BeginPullingStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, std::shared_ptr<PullingStream> *pulling_stream);
+		void EndPullingStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, const std::shared_ptr<PullingStream> &pulling_stream, bool result);
+		bool IsPullingStreamInApplication(const info::VHostAppName &vhost_app_name);
+
+		bool RequestPullStreamWithUrlsInternal(
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+			const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties);
+		bool RequestPullStreamWithOriginMapInternal(
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+			off_t offset);
+
+		// The provider connects to the origin and waits for the response here, so _application_mutex is released during the call.
+		// Otherwise, the handshakes with the origins of different streams are serialized.
+		// If the application is deleted in the meantime, the pulled stream is stopped.
+		std::shared_ptr<pvd::Stream> PullStreamFromProvider(
+			std::unique_lock<std::recursive_mutex> &app_lock,
+			const std::shared_ptr<PullProviderModuleInterface> &provider_module,
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::Application &app_info, const ov::String &stream_name,
+			const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties);
 	};
 }  // namespace ocst
@@ -52,6 +52,14 @@ namespace pvd
 
 	void OvtStream::Release()
 	{
+		{
+			std::lock_guard<std::mutex> lock(_handshake_mutex);
+
+			// The events of the socket being closed are ignored
+			_handshaking = false;
+			_socket_callback = nullptr;
+		}
+
 		if (_client_socket != nullptr)
 		{
 			_client_socket->Close();
@@ -86,6 +94,9 @@ namespace pvd
 
 		// For statistics
 		stop_watch.Start();
+		_first_frame_stop_watch.Start();
+		_first_frame_received = false;
+
 		if (!ConnectOrigin())
 		{
 			SetState(Stream::State::ERROR);
@@ -105,10 +116,13 @@ namespace pvd
 		if (!RequestPlay())
 		{
 			SetState(Stream::State::ERROR);
+			Release();
 			return false;
 		}
 		_origin_response_time_msec = stop_watch.Elapsed();
 
+		FinishHandshake();
+
 		_stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(pvd::Stream::GetSharedPtr()));
 		if (_stream_metrics != nullptr)
 		{
@@ -197,12 +211,27 @@ namespace pvd
 
 		_client_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_NODELAY, 1);
 		_client_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_QUICKACK, 1);
-		_client_socket->MakeBlocking();
 
-		struct timeval tv = {1, 500000};  // 1.5 sec
-		_client_socket->SetRecvTimeout(tv);
+		auto socket_callback = std::make_shared<OriginSocketCallback>(std::static_pointer_cast<OvtStream>(pvd::Stream::GetSharedPtr()));
+
+		{
+			std::lock_guard<std::mutex> lock(_handshake_mutex);
+
+			_socket_callback = socket_callback;
+			_handshaking = true;
+			_origin_connected = false;
+			_origin_failed = false;
+		}
+
+		if (_client_socket->MakeNonBlocking(socket_callback) == false)
+		{
+			SetState(State::ERROR);
+			logte("Could not make the socket nonblocking : (%s)", socket_address.ToString().CStr());
+			return false;
+		}
 
-		auto error = _client_socket->Connect(socket_address, 1500);
+		// The socket pool connects to the origin, and notifies the result with OnOriginConnected()
+		auto error = _client_socket->Connect(socket_address, OVT_CONNECT_TIMEOUT_MSEC);
 		if (error != nullptr)
 		{
 			SetState(State::ERROR);
@@ -210,6 +239,19 @@ namespace pvd
 			return false;
 		}
 
+		{
+			std::unique_lock<std::mutex> lock(_handshake_mutex);
+
+			if (WaitForOrigin(lock, [this]() -> bool { return _origin_connected; }) == false)
+			{
+				lock.unlock();
+
+				SetState(State::ERROR);
+				logte("Cannot connect to origin server : (%s)", socket_address.ToString().CStr());
+				return false;
+			}
+		}
+
 		SetState(State::CONNECTED);
 
 		return true;
@@ -592,24 +634,154 @@ namespace pvd
 
 	std::shared_ptr<ov::Data> OvtStream::ReceiveMessage()
 	{
-		while (true)
+		std::unique_lock<std::mutex> lock(_handshake_mutex);
+
+		if (WaitForOrigin(lock, [this]() -> bool { return _depacketizer.IsAvailableMessage(); }) == false)
+		{
+			lock.unlock();
+
+			logte("%s/%s(%u) - Could not receive message : %s", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), _origin_failed ? "disconnected" : "timed out");
+			SetState(State::ERROR);
+			return nullptr;
+		}
+
+		return _depacketizer.PopMessage();
+	}
+
+	bool OvtStream::WaitForOrigin(std::unique_lock<std::mutex> &lock, const std::function<bool()> &condition)
+	{
+		_handshake_condition.wait_for(lock, std::chrono::milliseconds(OVT_TIMEOUT_MSEC), [&]() -> bool {
+			return _origin_failed || condition();
+		});
+
+		return (_origin_failed == false) && condition();
+	}
+
+	void OvtStream::FinishHandshake()
+	{
+		std::lock_guard<std::mutex> lock(_handshake_mutex);
+
+		// From now on, the StreamMotor receives the packets from the socket
+		_handshaking = false;
+	}
+
+	void OvtStream::OnOriginConnected(const OriginSocketCallback *callback, const std::shared_ptr<const ov::SocketError> &error)
+	{
 		{
-			auto result = ReceivePacket();
-			if (result == false)
+			std::lock_guard<std::mutex> lock(_handshake_mutex);
+
+			if (callback != _socket_callback.get())
 			{
-				logte("%s/%s(%u) - Could not receive packet : err(%d)", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), static_cast<uint8_t>(result));
-				SetState(State::ERROR);
-				return nullptr;
+				return;
 			}
 
-			if (_depacketizer.IsAvailableMessage())
+			if (error != nullptr)
 			{
-				auto message = _depacketizer.PopMessage();
-				return message;
+				logte("[%s/%s] Could not connect to origin server: %s", GetApplicationName(), GetName().CStr(), error->What());
+				_origin_failed = true;
+			}
+			else
+			{
+				_origin_connected = true;
 			}
 		}
 
-		return nullptr;
+		_handshake_condition.notify_all();
+	}
+
+	void OvtStream::OnOriginReadable(const OriginSocketCallback *callback)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_handshake_mutex);
+
+			if ((_handshaking == false) || (callback != _socket_callback.get()))
+			{
+				return;
+			}
+
+			// The socket pool notifies again only after the socket is drained (edge-triggered)
+			uint8_t buffer[65535];
+
+			while (true)
+			{
+				size_t read_bytes = 0ULL;
+
+				auto error = _client_socket->Recv(buffer, sizeof(buffer), &read_bytes);
+				if (read_bytes == 0)
+				{
+					if (error != nullptr)
+					{
+						logte("[%s/%s] An error occurred while receiving packet: %s", GetApplicationName(), GetName().CStr(), error->What());
+						_origin_failed = true;
+					}
+
+					break;
+				}
+
+				if (_depacketizer.AppendPacket(buffer, read_bytes) == false)
+				{
+					logte("[%s/%s] An error occurred while parsing packet: Invalid packet", GetApplicationName(), GetName().CStr());
+					_origin_failed = true;
+					break;
+				}
+			}
+		}
+
+		_handshake_condition.notify_all();
+	}
+
+	void OvtStream::OnOriginClosed(const OriginSocketCallback *callback)
+	{
+		bool handshaking = false;
+
+		{
+			std::lock_guard<std::mutex> lock(_handshake_mutex);
+
+			if (callback != _socket_callback.get())
+			{
+				return;
+			}
+
+			_origin_failed = true;
+			handshaking = _handshaking;
+		}
+
+		_handshake_condition.notify_all();
+
+		if ((handshaking == false) && (GetState() == State::PLAYING))
+		{
+			// The socket pool has closed the socket, so the StreamMotor can't detect the disconnection.
+			// The application resumes the stream in ERROR state.
+			logtw("%s/%s(%u) - The connection to origin server was closed", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId());
+			SetState(State::ERROR);
+		}
+	}
+
+	void OvtStream::OriginSocketCallback::OnConnected(const std::shared_ptr<const ov::SocketError> &error)
+	{
+		auto stream = _stream.lock();
+		if (stream != nullptr)
+		{
+			stream->OnOriginConnected(this, error);
+		}
+	}
+
+	void OvtStream::OriginSocketCallback::OnReadable()
+	{
+		auto stream = _stream.lock();
+		if (stream != nullptr)
+		{
+			stream->OnOriginReadable(this);
+		}
+	}
+
+	void OvtStream::OriginSocketCallback::OnClosed()
+	{
+		auto stream = _stream.lock();
+		if (stream != nullptr)
+		{
+			stream->OnOriginClosed(this);
+		}
 	}
 
 	bool OvtStream::ReceivePacket(bool non_block)
@@ -701,6 +873,16 @@ namespace pvd
 
 				if (drop == false)
 				{
+					if (_first_frame_received == false)
+					{
+						_first_frame_received = true;
+
+						if (_stream_metrics != nullptr)
+						{
+							_stream_metrics->SetOriginFirstFrameTimeMSec(_first_frame_stop_watch.Elapsed());
+						}
+					}
+
 					SendFrame(media_packet);
 				}
 
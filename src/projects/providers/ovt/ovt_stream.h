@@ -15,7 +15,10 @@
 #include <base/provider/pull_provider/application.h>
 #include <base/provider/pull_provider/stream.h>
 
+#include <condition_variable>
+
 #define OVT_TIMEOUT_MSEC		3000
+#define OVT_CONNECT_TIMEOUT_MSEC	1500
 
 namespace pvd
 {
@@ -53,6 +56,24 @@ namespace pvd
 			ALREADY_COMPLETED,
 		};
 
+		// Delivers the events of the socket pool to the stream while connecting to the origin.
+		// It refers to the stream weakly, so the socket doesn't keep the stream alive
+		class OriginSocketCallback : public ov::SocketAsyncInterface
+		{
+		public:
+			OriginSocketCallback(const std::shared_ptr<OvtStream> &stream)
+				: _stream(stream)
+			{
+			}
+
+			void OnConnected(const std::shared_ptr<const ov::SocketError> &error) override;
+			void OnReadable() override;
+			void OnClosed() override;
+
+		private:
+			std::weak_ptr<OvtStream> _stream;
+		};
+
 		std::shared_ptr<pvd::OvtProvider> GetOvtProvider();
 
 		bool StartStream(const std::shared_ptr<const ov::Url> &url) override; // Start
@@ -70,9 +91,28 @@ namespace pvd
 		bool ReceivePacket(bool non_block = false);
 		std::shared_ptr<ov::Data> ReceiveMessage();
 
+		// Called from the socket pool. The callbacks of the previous socket are ignored
+		void OnOriginConnected(const OriginSocketCallback *callback, const std::shared_ptr<const ov::SocketError> &error);
+		void OnOriginReadable(const OriginSocketCallback *callback);
+		void OnOriginClosed(const OriginSocketCallback *callback);
+		// Waits until the condition is satisfied by the socket pool, the socket is closed, or OVT_TIMEOUT_MSEC elapses
+		bool WaitForOrigin(std::unique_lock<std::mutex> &lock, const std::function<bool()> &condition);
+		void FinishHandshake();
+
 		void Release();
 
 		std::shared_ptr<ov::Socket> _client_socket = nullptr;
+		std::shared_ptr<OriginSocketCallback> _socket_callback = nullptr;
+
+		// The socket is nonblocking, and the socket pool connects to the origin and receives the DESCRIBE/PLAY responses.
+		// The thread pulling the stream only waits for the result with a timeout.
+		// After PLAY is responded, the StreamMotor receives the packets from the socket.
+		std::mutex _handshake_mutex;
+		std::condition_variable _handshake_condition;
+		bool _handshaking = false;
+		bool _origin_connected = false;
+		bool _origin_failed = false;
+
 		std::shared_ptr<const ov::Url> _curr_url = nullptr;
 
 		uint32_t _last_request_id;
@@ -80,6 +120,10 @@ namespace pvd
 		int64_t _origin_request_time_msec = 0;
 		int64_t _origin_response_time_msec = 0;
 
+		// To measure time-to-first-frame
+		ov::StopWatch _first_frame_stop_watch;
+		bool _first_frame_received = false;
+
 		std::shared_mutex	_packetizer_lock;
 		std::shared_ptr<OvtPacketizer>	_packetizer;
 		OvtDepacketizer _depacketizer;
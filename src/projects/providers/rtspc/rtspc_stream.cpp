@@ -110,6 +110,9 @@ namespace pvd
 		ov::StopWatch stop_watch;
 
 		stop_watch.Start();
+		_first_frame_stop_watch.Start();
+		_first_frame_received = false;
+
 		if (ConnectTo() == false)
 		{
 			return false;
@@ -1086,6 +1089,16 @@ namespace pvd
 			_sent_sequence_header = true;
 		}
 
+		if (_first_frame_received == false)
+		{
+			_first_frame_received = true;
+
+			if (_stream_metrics != nullptr)
+			{
+				_stream_metrics->SetOriginFirstFrameTimeMSec(_first_frame_stop_watch.Elapsed());
+			}
+		}
+
 		SendFrame(frame);
 	}
 
@@ -169,6 +169,10 @@ namespace pvd
 		int64_t _origin_response_time_msec = 0;
 		std::shared_ptr<mon::StreamMetrics> _stream_metrics;
 
+		// To measure time-to-first-frame
+		ov::StopWatch _first_frame_stop_watch;
+		bool _first_frame_received = false;
+
 		ov::StopWatch _ping_timer;
 	};
 }
\ No newline at end of file
@@ -39,6 +39,13 @@ LLHlsApplication::LLHlsApplication(const std::shared_ptr<pub::Publisher> &publis
 	}
 
 	_origin_mode = llhls_config.IsOriginMode();
+
+	auto dvr_config = llhls_config.GetDvr();
+	auto dvr_cache_size = static_cast<size_t>(std::max(dvr_config.GetMaxCacheSize(), 0)) * 1024 * 1024;
+	if (dvr_config.IsEnabled() && (dvr_cache_size > 0))
+	{
+		_dvr_cache = std::make_shared<bmff::FMP4DvrCache>(dvr_cache_size);
+	}
 }
 
 LLHlsApplication::~LLHlsApplication()
@@ -32,6 +32,12 @@ public:
 		return _origin_mode;
 	}
 
+	// nullptr if the DVR segment cache is disabled
+	const std::shared_ptr<bmff::FMP4DvrCache> &GetDvrCache() const
+	{
+		return _dvr_cache;
+	}
+
 private:
 	bool Start() override;
 	bool Stop() override;
@@ -42,4 +48,6 @@ private:
 
 	http::CorsManager _cors_manager;
 	bool _origin_mode = false;
+	// Shared by all streams of the application, so MaxCacheSize bounds the memory of the whole application
+	std::shared_ptr<bmff::FMP4DvrCache> _dvr_cache;
 };
@@ -111,7 +111,7 @@ bool LLHlsChunklist::AppendSegmentInfo(const SegmentInfo &info)
 
 	segment->SetCompleted();
 
-	UpdateCacheForDefaultChunklist();
+	UpdateChunklistCache();
 	if (is_new_segment)
 	{
 		_last_segment_sequence = info.GetSequence();
@@ -149,7 +149,7 @@ bool LLHlsChunklist::AppendPartialSegmentInfo(uint32_t segment_sequence, const S
 
 	segment->InsertPartialSegmentInfo(std::make_shared<SegmentInfo>(info));
 	
-	UpdateCacheForDefaultChunklist();
+	UpdateChunklistCache();
 	_last_partial_segment_sequence = info.GetSequence();
 
 	return true;
@@ -180,20 +180,118 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 	return true;
 }
 
-void LLHlsChunklist::UpdateCacheForDefaultChunklist()
+void LLHlsChunklist::UpdateChunklistCache()
 {
-	ov::String chunklist = MakeChunklist("", false, false);
+	auto default_chunklist = RenderChunklist(false, false);
+	default_chunklist->gzip_chunklist = ov::Zip::CompressGzip(default_chunklist->chunklist.ToData(false));
+
+	std::unordered_map<ov::String, std::shared_ptr<RenderedChunklist>> rendered_chunklists;
+	rendered_chunklists.emplace(ov::String::FormatString("%d%d", false, false), default_chunklist);
+
+	// The chunklists rendered before this update are released when the sessions using them have finished
+	std::lock_guard<std::shared_mutex> lock(_rendered_chunklists_guard);
+	_rendered_chunklists.swap(rendered_chunklists);
+	_rendered_chunklists_version++;
+}
+
+std::shared_ptr<LLHlsChunklist::RenderedChunklist> LLHlsChunklist::RenderChunklist(bool skip, bool legacy) const
+{
+	auto rendered_chunklist = std::make_shared<RenderedChunklist>();
+	auto chunklist = MakeChunklist(LLHLS_CHUNKLIST_QUERY_PLACEHOLDER, skip, legacy);
+
+	const auto placeholder = "?" LLHLS_CHUNKLIST_QUERY_PLACEHOLDER;
+	const auto placeholder_length = ::strlen(placeholder);
+	off_t start = 0;
+
+	while (true)
+	{
+		auto position = chunklist.IndexOf(placeholder, start);
+
+		if (position < 0)
+		{
+			rendered_chunklist->pieces.push_back(chunklist.Substring(start));
+			break;
+		}
+
+		rendered_chunklist->pieces.push_back(chunklist.Substring(start, position - start));
+		start = position + placeholder_length;
+	}
+
+	rendered_chunklist->chunklist = rendered_chunklist->ToString("");
+
+	return rendered_chunklist;
+}
+
+ov::String LLHlsChunklist::RenderedChunklist::ToString(const ov::String &query_string) const
+{
+	if (query_string.IsEmpty() && (chunklist.IsEmpty() == false))
+	{
+		return chunklist;
+	}
+
+	size_t length = 0;
+	for (const auto &piece : pieces)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		_cached_default_chunklist = chunklist;
+		length += piece.GetLength() + 1 + query_string.GetLength();
 	}
 
+	ov::String output(length);
+
+	for (size_t index = 0; index < pieces.size(); index++)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		if ((index > 0) && (query_string.IsEmpty() == false))
+		{
+			output.Append("?");
+			output.Append(query_string);
+		}
+
+		output.Append(pieces[index]);
 	}
+
+	return output;
+}
+
+std::shared_ptr<LLHlsChunklist::RenderedChunklist> LLHlsChunklist::GetRenderedChunklist(bool skip, bool legacy) const
+{
+	auto key = ov::String::FormatString("%d%d", skip, legacy);
+
+	{
+		std::shared_lock<std::shared_mutex> lock(_rendered_chunklists_guard);
+
+		auto item = _rendered_chunklists.find(key);
+		if (item != _rendered_chunklists.end())
+		{
+			return item->second;
+		}
+	}
+
+	// Concurrent requests for the same variant wait for the first one instead of rendering again
+	std::lock_guard<std::mutex> render_lock(_render_guard);
+
+	uint64_t version;
+
+	{
+		std::shared_lock<std::shared_mutex> lock(_rendered_chunklists_guard);
+
+		auto item = _rendered_chunklists.find(key);
+		if (item != _rendered_chunklists.end())
+		{
+			return item->second;
+		}
+
+		version = _rendered_chunklists_version;
+	}
+
+	auto rendered_chunklist = RenderChunklist(skip, legacy);
+
+	std::lock_guard<std::shared_mutex> lock(_rendered_chunklists_guard);
+	// If the playlist has been updated while rendering, the chunklist must not be cached in the new map (it may be older than the update)
+	if (version == _rendered_chunklists_version)
+	{
+		_rendered_chunklists.emplace(key, rendered_chunklist);
+	}
+
+	return rendered_chunklist;
 }
 
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
@@ -472,23 +570,28 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 		return "";
 	}
 
-	if (query_string.IsEmpty() && skip == false && legacy == false && vod == false && vod_start_segment_number == 0 && !_cached_default_chunklist.IsEmpty())
+	if (vod == true)
 	{
-		// return cached chunklist for default chunklist
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		return _cached_default_chunklist;
+		return MakeChunklist(query_string, skip, legacy, vod, vod_start_segment_number);
 	}
 
-	return MakeChunklist(query_string, skip, legacy, vod, vod_start_segment_number);
+	return GetRenderedChunklist(skip, legacy)->ToString(query_string);
 }
 
 std::shared_ptr<const ov::Data> LLHlsChunklist::ToGzipData(const ov::String &query_string, bool skip, bool legacy) const
 {
-	if (query_string.IsEmpty() && skip == false && legacy == false && _cached_default_chunklist_gzip != nullptr)
+	auto rendered_chunklist = GetRenderedChunklist(skip, legacy);
+
+	if (query_string.IsEmpty() == false)
+	{
+		return ov::Zip::CompressGzip(rendered_chunklist->ToString(query_string).ToData(false));
+	}
+
+	std::lock_guard<std::mutex> lock(rendered_chunklist->gzip_guard);
+	if (rendered_chunklist->gzip_chunklist == nullptr)
 	{
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		return _cached_default_chunklist_gzip;
+		rendered_chunklist->gzip_chunklist = ov::Zip::CompressGzip(rendered_chunklist->chunklist.ToData(false));
 	}
 
-	return ov::Zip::CompressGzip(ToString(query_string, skip, legacy).ToData(false));
+	return rendered_chunklist->gzip_chunklist;
 }
@@ -14,6 +14,10 @@
 
 #include "modules/containers/bmff/cenc.h"
 
+// Rendered in place of the query string of the URIs in the cached chunklists, and replaced with the query string of the session when it is served.
+// (It can't be a part of a URI)
+#define LLHLS_CHUNKLIST_QUERY_PLACEHOLDER "\x01"
+
 class LLHlsChunklist
 {
 public:
@@ -194,6 +198,26 @@ private:
 
 	ov::String MakeExtXKey() const;
 
+	// A chunklist rendered for a variant of the request (skip, legacy).
+	// It is rendered at most once per playlist update, no matter how many sessions request it.
+	// The query string of each session (e.g. session key) is inserted between the pieces when it is served.
+	struct RenderedChunklist
+	{
+		// The chunklist split at the URIs that need the query string ("<piece>?<query string><piece>...")
+		std::vector<ov::String> pieces;
+		// The chunklist without the query string
+		ov::String chunklist;
+
+		std::mutex gzip_guard;
+		// Compressed at most once. The chunklists with the query string differ for each session, so they are compressed for every request
+		std::shared_ptr<const ov::Data> gzip_chunklist;
+
+		ov::String ToString(const ov::String &query_string) const;
+	};
+
+	std::shared_ptr<RenderedChunklist> RenderChunklist(bool skip, bool legacy) const;
+	std::shared_ptr<RenderedChunklist> GetRenderedChunklist(bool skip, bool legacy) const;
+
 	std::shared_ptr<const MediaTrack> _track;
 
 	ov::String _url;
@@ -221,13 +245,17 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _renditions;
 	mutable std::shared_mutex _renditions_guard;
 
-	ov::String _cached_default_chunklist;
-	mutable std::shared_mutex _cached_default_chunklist_guard;
-
-	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
-	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
+	// Key: <skip><legacy>
+	// Replaced with a new map whenever the playlist is updated
+	mutable std::unordered_map<ov::String, std::shared_ptr<RenderedChunklist>> _rendered_chunklists;
+	// Serializes the rendering of the variants that are not rendered yet
+	mutable std::mutex _render_guard;
+	mutable std::shared_mutex _rendered_chunklists_guard;
+	// Increased whenever _rendered_chunklists is replaced
+	uint64_t _rendered_chunklists_version = 0;
 
 	bmff::CencProperty _cenc_property;
 
-	void UpdateCacheForDefaultChunklist();
+	// Invalidates the rendered chunklists, and renders the default chunklist (no skip, non-legacy) in advance
+	void UpdateChunklistCache();
 };
\ No newline at end of file
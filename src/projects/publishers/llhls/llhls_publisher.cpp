@@ -545,6 +545,8 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 							SendCloseAdmissionWebhooks(request_info);
 						}
 
+						// The session no longer answers the blocking requests
+						std::static_pointer_cast<LLHlsStream>(stream)->RemovePlaylistWaiters(session->GetId());
 						stream->RemoveSession(session->GetId());
 					}
 				}
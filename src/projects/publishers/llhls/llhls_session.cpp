@@ -159,6 +159,13 @@ void LLHlsSession::SendOutgoingData(const std::any &notification)
 
 void LLHlsSession::OnMessageReceived(const std::any &message)
 {
+	if (message.type() == typeid(std::shared_ptr<LLHlsStream::PlaylistUpdatedEvent>))
+	{
+		// Woken up from the wait-list of the stream
+		SendOutgoingData(message);
+		return;
+	}
+
 	std::shared_ptr<http::svr::HttpExchange> exchange = nullptr;
 	try 
 	{
@@ -392,6 +399,8 @@ void LLHlsSession::ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchang
 
 	auto request = exchange->GetRequest();
 	auto response = exchange->GetResponse();
+	// Playlists are blocking requests of the player, so they overtake the segments being downloaded
+	response->SetUrgency(HTTP_URGENCY_HIGHEST);
 	auto request_uri = exchange->GetRequest()->GetParsedUri();
 
 	ov::String content_encoding = "identity";
@@ -491,6 +500,8 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 	auto request = exchange->GetRequest();
 	auto request_uri = request->GetParsedUri();
 	auto response = exchange->GetResponse();
+	// Playlists are blocking requests of the player, so they overtake the segments being downloaded
+	response->SetUrgency(HTTP_URGENCY_HIGHEST);
 	bool has_delivery_directives = request_uri->HasQueryKey("_HLS_msn");
 
 	if (msn == -1 && part == -1)
@@ -602,7 +613,7 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 		}
 
 		// Send error response
-		response->SetStatusCode(http::StatusCode::NotFound);
+		response->SetStatusCode((result == LLHlsStream::RequestResult::BadRequest) ? http::StatusCode::BadRequest : http::StatusCode::NotFound);
 	}
 
 	ResponseData(exchange);
@@ -617,6 +628,8 @@ void LLHlsSession::ResponseInitializationSegment(const std::shared_ptr<http::svr
 	}
 
 	auto response = exchange->GetResponse();
+	// The player can not play the partial segments without the initialization segment
+	response->SetUrgency(HTTP_URGENCY_ABOVE_DEFAULT);
 
 	// Get the initialization segment
 	auto [result, initialization_segment] = llhls_stream->GetInitializationSegment(track_id);
@@ -669,9 +682,18 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 	}
 
 	auto response = exchange->GetResponse();
+	// Full segments are mostly downloaded in advance (e.g. by the legacy HLS player), so they are sent last
+	response->SetUrgency(HTTP_URGENCY_LOWEST);
+
+	// Get the segment (a cold DVR segment is sent from the file without loading it into memory)
+	ov::String dvr_file_path;
+	auto [result, segment] = llhls_stream->GetSegment(track_id, segment_number, &dvr_file_path);
+	if ((result == LLHlsStream::RequestResult::Success) && (segment == nullptr) && (response->AppendFile(dvr_file_path) == false))
+	{
+		// The DVR segment has been deleted
+		result = LLHlsStream::RequestResult::NotFound;
+	}
 
-	// Get the segment
-	auto [result, segment] = llhls_stream->GetSegment(track_id, segment_number);
 	if (result == LLHlsStream::RequestResult::Success)
 	{
 		// Send the segment
@@ -700,7 +722,10 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(segment);
+		if (segment != nullptr)
+		{
+			response->AppendData(segment);
+		}
 	}
 	else
 	{
@@ -720,6 +745,8 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 	}
 
 	auto response = exchange->GetResponse();
+	// Partial segments are on the live edge
+	response->SetUrgency(HTTP_URGENCY_HIGH);
 
 	// Get the partial segment
 	auto [result, partial_segment] = llhls_stream->GetChunk(track_id, segment_number, partial_number);
@@ -792,6 +819,9 @@ void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &
 void LLHlsSession::OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
 	logtd("LLHlsSession::OnPlaylistUpdated track_id: %d, msn: %lld, part: %lld", track_id, msn, part);
+
+	TimeOutPendingRequests();
+
 	// Find the pending request
 	auto it = _pending_requests.begin();
 	while (it != _pending_requests.end())
@@ -802,6 +832,7 @@ void LLHlsSession::OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn
 			// Send the playlist
 			auto exchange = it->exchange;
 			ResponsePlaylist(exchange, it->file_name, it->legacy, false);
+			RemovePlaylistWaiter(*it);
 			it = _pending_requests.erase(it);
 		}
 		else if ( (it->track_id == track_id) && 
@@ -830,6 +861,7 @@ void LLHlsSession::OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn
 			}
 
 			// Remove the request
+			RemovePlaylistWaiter(*it);
 			it = _pending_requests.erase(it);
 		}
 		else
@@ -851,11 +883,19 @@ bool LLHlsSession::AddPendingRequest(const std::shared_ptr<http::svr::HttpExchan
 	request.partial_number = partial_number;
 	request.skip = skip;
 	request.legacy = legacy;
+	request.created_time_ms = ov::Clock::NowMSec();
 	request.exchange = exchange;
 
 	// Add the request to the pending list
 	_pending_requests.push_back(request);
 
+	// The stream wakes up this session when the part is appended
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream != nullptr)
+	{
+		llhls_stream->AddPlaylistWaiter((type == RequestType::Playlist) ? LLHlsStream::AnyTrackId : track_id, segment_number, partial_number, GetId());
+	}
+
 	if (_pending_requests.size() > MAX_PENDING_REQUESTS)
 	{
 		logtd("[%s/%s/%u] Too many pending requests (%u)", 
@@ -866,4 +906,44 @@ bool LLHlsSession::AddPendingRequest(const std::shared_ptr<http::svr::HttpExchan
 	}
 
 	return true;
+}
+
+void LLHlsSession::RemovePlaylistWaiter(const PendingRequest &request)
+{
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream != nullptr)
+	{
+		llhls_stream->RemovePlaylistWaiter((request.type == RequestType::Playlist) ? LLHlsStream::AnyTrackId : request.track_id, request.segment_number, request.partial_number, GetId());
+	}
+}
+
+void LLHlsSession::TimeOutPendingRequests()
+{
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if ((llhls_stream == nullptr) || _pending_requests.empty())
+	{
+		return;
+	}
+
+	int64_t now_ms = ov::Clock::NowMSec();
+	auto timeout_ms = llhls_stream->GetPlaylistWaiterTimeoutMs();
+
+	auto it = _pending_requests.begin();
+	while (it != _pending_requests.end())
+	{
+		if ((now_ms - it->created_time_ms) < timeout_ms)
+		{
+			++it;
+			continue;
+		}
+
+		logtd("[%s/%s/%u] The pending request for %s has timed out",
+			  GetApplication()->GetName().CStr(), GetStream()->GetName().CStr(), GetId(), it->file_name.CStr());
+
+		it->exchange->GetResponse()->SetStatusCode(http::StatusCode::ServiceUnavailable);
+		ResponseData(it->exchange);
+
+		RemovePlaylistWaiter(*it);
+		it = _pending_requests.erase(it);
+	}
 }
\ No newline at end of file
@@ -96,11 +96,16 @@ private:
 		int64_t partial_number = -1;
 		bool skip = false;
 		bool legacy = false;
+		int64_t created_time_ms = 0;
 
 		std::shared_ptr<http::svr::HttpExchange> exchange;
 	};
 
 	bool AddPendingRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const RequestType &type, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number, const bool &skip, const bool &legacy);
+	// Removes the request from the wait-list of the stream
+	void RemovePlaylistWaiter(const PendingRequest &request);
+	// Responds 503 to the requests that have been pending longer than the timeout of the stream
+	void TimeOutPendingRequests();
 
 	// Session runs on a single thread, so it doesn't need mutex
 	std::list<PendingRequest> _pending_requests;
@@ -75,6 +75,7 @@ bool LLHlsStream::Start()
 	_storage_config.dvr_enabled = dvr_config.IsEnabled();
 	_storage_config.dvr_storage_path = dvr_config.GetTempStoragePath();
 	_storage_config.dvr_duration_sec = dvr_config.GetMaxDuration();
+	_storage_config.dvr_cache = std::static_pointer_cast<LLHlsApplication>(GetApplication())->GetDvrCache();
 	_storage_config.server_time_based_segment_numbering = llhls_config.IsServerTimeBasedSegmentNumbering();
 
 	_configured_part_hold_back = llhls_config.GetPartHoldBack();
@@ -714,6 +715,22 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 			return {RequestResult::NotFound, nullptr};
 		}
 
+		// https://datatracker.ietf.org/doc/html/draft-pantos-hls-rfc8216bis#section-6.2.5.2
+		// If the _HLS_msn is greater than the last Media Sequence Number plus two, or if the _HLS_part exceeds
+		// the last Partial Segment by the Advance Part Limit, the server SHOULD immediately return Bad Request.
+		if (last_msn >= 0)
+		{
+			auto chunk_duration_ms = std::max<int64_t>(static_cast<int64_t>(_packager_config.chunk_duration_ms), 1);
+			int64_t advance_part_limit = (chunk_duration_ms < 1000) ? ((3000 + chunk_duration_ms - 1) / chunk_duration_ms) : 3;
+
+			if ((msn > last_msn + 2) ||
+				((msn == last_msn) && (psn > last_psn + advance_part_limit)) ||
+				((msn > last_msn) && (psn >= advance_part_limit)))
+			{
+				return {RequestResult::BadRequest, nullptr};
+			}
+		}
+
 		if (msn > last_msn || (msn >= last_msn && psn > last_psn))
 		{
 			// Hold the request until a Playlist contains a Segment with the requested Sequence Number
@@ -741,7 +758,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, storage->GetInitializationSection()};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
+std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number, ov::String *dvr_file_path) const
 {
 	auto storage = GetStorage(track_id);
 	if (storage == nullptr)
@@ -750,7 +767,13 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 		return {RequestResult::NotFound, nullptr};
 	}
 
-	auto segment = storage->GetMediaSegment(segment_number);
+	auto segment = storage->GetMediaSegment(segment_number, dvr_file_path);
+	if ((segment == nullptr) && (dvr_file_path != nullptr) && (dvr_file_path->IsEmpty() == false))
+	{
+		// Cold DVR segment - it will be sent from the file
+		return {RequestResult::Success, nullptr};
+	}
+
 	if (segment == nullptr)
 	{
 		logtw("Could not find segment for track_id = %d, segment = %ld (last_segment = %ld)", track_id, segment_number, storage->GetLastSegmentNumber());
@@ -1264,11 +1287,170 @@ void LLHlsStream::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t
 
 void LLHlsStream::NotifyPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
-	// Make std::any for broadcast
-	// I think make_shared is better than copy sizeof(PlaylistUpdatedEvent) to all sessions
-	auto event = std::make_shared<PlaylistUpdatedEvent>(track_id, msn, part);
+	std::vector<session_id_t> session_ids;
+
+	{
+		std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+		TakePlaylistWaiters(track_id, msn, part, session_ids);
+		TakePlaylistWaiters(AnyTrackId, msn, part, session_ids);
+
+		// The sessions whose requests have timed out are woken up with this update, and they respond to the requests
+		int64_t now_ms = ov::Clock::NowMSec();
+		if ((now_ms - _last_playlist_waiters_sweep_time_ms) >= LLHLS_PLAYLIST_WAITER_SWEEP_INTERVAL_MS)
+		{
+			_last_playlist_waiters_sweep_time_ms = now_ms;
+			TakeTimedOutPlaylistWaiters(now_ms, session_ids);
+		}
+	}
+
+	if (session_ids.empty())
+	{
+		return;
+	}
+
+	// A session can wait for several parts (e.g. chunklist and partial segment)
+	std::sort(session_ids.begin(), session_ids.end());
+	session_ids.erase(std::unique(session_ids.begin(), session_ids.end()), session_ids.end());
+
+	// The event is shared by all sessions waiting for this part
+	WakePlaylistWaiters(session_ids, std::make_shared<PlaylistUpdatedEvent>(track_id, msn, part));
+}
+
+void LLHlsStream::TakePlaylistWaiters(const int32_t &track_id, const int64_t &msn, const int64_t &part, std::vector<session_id_t> &session_ids)
+{
+	auto begin = _playlist_waiters.lower_bound({track_id, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::min()});
+	auto end = _playlist_waiters.upper_bound({track_id, msn, part});
+
+	for (auto it = begin; it != end; ++it)
+	{
+		for (const auto &waiter : it->second)
+		{
+			session_ids.push_back(waiter.session_id);
+		}
+	}
+
+	_playlist_waiters.erase(begin, end);
+}
+
+void LLHlsStream::TakeTimedOutPlaylistWaiters(int64_t now_ms, std::vector<session_id_t> &session_ids)
+{
+	auto timeout_ms = GetPlaylistWaiterTimeoutMs();
+
+	for (auto it = _playlist_waiters.begin(); it != _playlist_waiters.end();)
+	{
+		auto &waiters = it->second;
+
+		waiters.erase(std::remove_if(waiters.begin(), waiters.end(), [&](const PlaylistWaiter &waiter) -> bool {
+						  if ((now_ms - waiter.registered_time_ms) < timeout_ms)
+						  {
+							  return false;
+						  }
+
+						  session_ids.push_back(waiter.session_id);
+						  return true;
+					  }),
+					  waiters.end());
+
+		it = waiters.empty() ? _playlist_waiters.erase(it) : std::next(it);
+	}
+}
+
+int64_t LLHlsStream::GetPlaylistWaiterTimeoutMs() const
+{
+	return static_cast<int64_t>(_storage_config.segment_duration_ms) * LLHLS_PLAYLIST_WAITER_TIMEOUT_TARGET_DURATIONS;
+}
+
+void LLHlsStream::WakePlaylistWaiters(const std::vector<session_id_t> &session_ids, const std::shared_ptr<PlaylistUpdatedEvent> &event)
+{
 	auto notification = std::make_any<std::shared_ptr<PlaylistUpdatedEvent>>(event);
-	BroadcastPacket(notification);
+
+	for (const auto &session_id : session_ids)
+	{
+		auto session = GetSession(session_id);
+		if (session == nullptr)
+		{
+			// The session has been closed while waiting
+			continue;
+		}
+
+		// The event is processed in the thread of the session
+		SendMessage(session, notification);
+	}
+}
+
+void LLHlsStream::AddPlaylistWaiter(const int32_t &track_id, const int64_t &msn, const int64_t &part, session_id_t session_id)
+{
+	int64_t last_msn = -1, last_part = -1;
+	std::shared_ptr<LLHlsChunklist> chunklist = nullptr;
+
+	if (track_id != AnyTrackId)
+	{
+		chunklist = GetChunklistWriter(track_id);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+		// The part may have been appended after the session checked the playlist.
+		// NotifyPlaylistUpdated() takes the waiters after the chunklist is updated, so checking it here under the lock never misses the update.
+		bool already_updated = (chunklist != nullptr) && chunklist->GetLastSequenceNumber(last_msn, last_part) &&
+							   ((msn < last_msn) || (msn == last_msn && part <= last_part));
+
+		if (already_updated == false)
+		{
+			_playlist_waiters[{track_id, msn, part}].push_back({session_id, ov::Clock::NowMSec()});
+			return;
+		}
+	}
+
+	// Wake up immediately
+
+	WakePlaylistWaiters({session_id}, std::make_shared<PlaylistUpdatedEvent>(track_id, last_msn, last_part));
+}
+
+void LLHlsStream::RemovePlaylistWaiter(const int32_t &track_id, const int64_t &msn, const int64_t &part, session_id_t session_id)
+{
+	std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+	auto it = _playlist_waiters.find({track_id, msn, part});
+	if (it == _playlist_waiters.end())
+	{
+		// Already taken by NotifyPlaylistUpdated()
+		return;
+	}
+
+	auto &waiters = it->second;
+	auto waiter = std::find_if(waiters.begin(), waiters.end(), [session_id](const PlaylistWaiter &waiter) -> bool {
+		return waiter.session_id == session_id;
+	});
+
+	if (waiter != waiters.end())
+	{
+		waiters.erase(waiter);
+	}
+
+	if (waiters.empty())
+	{
+		_playlist_waiters.erase(it);
+	}
+}
+
+void LLHlsStream::RemovePlaylistWaiters(session_id_t session_id)
+{
+	std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+	for (auto it = _playlist_waiters.begin(); it != _playlist_waiters.end();)
+	{
+		auto &waiters = it->second;
+
+		waiters.erase(std::remove_if(waiters.begin(), waiters.end(), [session_id](const PlaylistWaiter &waiter) -> bool {
+						  return waiter.session_id == session_id;
+					  }),
+					  waiters.end());
+
+		it = waiters.empty() ? _playlist_waiters.erase(it) : std::next(it);
+	}
 }
 
 int64_t LLHlsStream::GetMinimumLastSegmentNumber() const
@@ -25,6 +25,11 @@
 // max initial media packet buffer size, for OOM protection
 #define MAX_INITIAL_MEDIA_PACKET_BUFFER_SIZE		10000
 
+// A blocking request that is not answered within (target duration * N) times out
+#define LLHLS_PLAYLIST_WAITER_TIMEOUT_TARGET_DURATIONS	3
+// Interval to look for the timed-out waiters
+#define LLHLS_PLAYLIST_WAITER_SWEEP_INTERVAL_MS		1000
+
 class LLHlsStream : public pub::Stream, public bmff::FMp4StorageObserver
 {
 public:
@@ -43,6 +48,7 @@ public:
 	{
 		Success, // Success
 		Accepted, // The request is accepted but not yet processed, it will be processed later
+		BadRequest, // The delivery directives are too far ahead of the playlist
 		NotFound, // The request is not found
 		UnknownError,
 	};
@@ -68,9 +74,23 @@ public:
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, bool gzip, bool legacy, bool include_path=true);
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetInitializationSegment(const int32_t &track_id) const;
-	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
+	// If <dvr_file_path> is not nullptr and the segment is a DVR segment that is not cached in memory,
+	// returns Success with nullptr and sets <dvr_file_path> so that the file can be sent directly
+	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number, ov::String *dvr_file_path = nullptr) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
 
+	// Registers a session holding a request until the playlist of the track contains (msn, part).
+	// When the part is appended, only the registered sessions are woken up with PlaylistUpdatedEvent (not broadcast).
+	// If track_id is AnyTrackId, the session is woken up by an update of any track.
+	static constexpr int32_t AnyTrackId = -1;
+	void AddPlaylistWaiter(const int32_t &track_id, const int64_t &msn, const int64_t &part, session_id_t session_id);
+	// Called when the request has been answered or has timed out
+	void RemovePlaylistWaiter(const int32_t &track_id, const int64_t &msn, const int64_t &part, session_id_t session_id);
+	// Called when the session is closed
+	void RemovePlaylistWaiters(session_id_t session_id);
+	// A waiter is woken up after this time even if the part is not appended, so that the session can time out the request
+	int64_t GetPlaylistWaiterTimeoutMs() const;
+
 	// <result, error message>
 	std::tuple<bool, ov::String> StartDump(const std::shared_ptr<info::Dump> &dump_info);
 	std::tuple<bool, ov::String> StopDump(const std::shared_ptr<info::Dump> &dump_info);
@@ -166,6 +186,23 @@ private:
 	std::map<ov::String, std::shared_ptr<mdl::Dump>> _dumps;
 	std::shared_mutex _dumps_lock;
 
+	// Wait-list of blocking playlist reloads
+	struct PlaylistWaiter
+	{
+		session_id_t session_id;
+		int64_t registered_time_ms;
+	};
+	// <track_id, msn, part> : sessions waiting for the part
+	std::map<std::tuple<int32_t, int64_t, int64_t>, std::vector<PlaylistWaiter>> _playlist_waiters;
+	std::mutex _playlist_waiters_lock;
+	int64_t _last_playlist_waiters_sweep_time_ms = 0;
+
+	// Takes the session IDs waiting for (msn, part) or earlier of the track from the wait-list
+	void TakePlaylistWaiters(const int32_t &track_id, const int64_t &msn, const int64_t &part, std::vector<session_id_t> &session_ids);
+	// Takes the session IDs that have been waiting longer than GetPlaylistWaiterTimeoutMs()
+	void TakeTimedOutPlaylistWaiters(int64_t now_ms, std::vector<session_id_t> &session_ids);
+	void WakePlaylistWaiters(const std::vector<session_id_t> &session_ids, const std::shared_ptr<PlaylistUpdatedEvent> &event);
+
 	// DRM
 	bool _indentity_enabled = false; // for custom license server and player purposes
 	bool _widevine_enabled = false;
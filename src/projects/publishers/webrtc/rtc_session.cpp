@@ -98,7 +98,7 @@ bool RtcSession::Start()
 
 	_dtls_transport = std::make_shared<DtlsTransport>();
 	std::shared_ptr<RtcApplication> application = std::static_pointer_cast<RtcApplication>(GetApplication());
-	_dtls_transport->SetLocalCertificate(application->GetCertificate());
+	_dtls_transport->SetLocalCertificate(application->GetCertificate(), std::static_pointer_cast<RtcStream>(GetStream())->IsAesGcmPreferred());
 	_dtls_transport->StartDTLS();
 
 	// RFC3264
@@ -161,6 +161,12 @@ bool RtcSession::Start()
 
 	_auto_abr = _playlist->IsWebRtcAutoAbr();
 
+	_zero_copy_fan_out = std::static_pointer_cast<RtcStream>(GetStream())->IsZeroCopyFanOutEnabled();
+	if (_zero_copy_fan_out == true)
+	{
+		_rtp_fan_out_buffers.resize(RTC_SESSION_FAN_OUT_BUFFER_COUNT);
+	}
+
 	_current_rendition = _playlist->GetFirstRendition();
 	RecordAutoSelectedRendition(_current_rendition, true);
 
@@ -222,6 +228,19 @@ bool RtcSession::Stop()
 
 	if(_srtp_transport != nullptr)
 	{
+		ReportSrtpStatistics(ov::Clock::NowMSec());
+
+		auto srtp_statistics = GetSrtpStatistics();
+
+		if (srtp_statistics.protect_count > 0)
+		{
+			logti("SRTP statistics of session(%u) - Suite(%s) Protected(%" PRIu64 " packets, %" PRIu64 " bytes) ProtectTime(total: %.3f ms, avg: %.3f us/packet)",
+				  GetId(), SrtpAdapter::GetCryptoSuiteName(srtp_statistics.crypto_suite),
+				  srtp_statistics.protect_count, srtp_statistics.protect_bytes,
+				  srtp_statistics.protect_time_ns / 1000000.0,
+				  (srtp_statistics.protect_time_ns / 1000.0) / srtp_statistics.protect_count);
+		}
+
 		_srtp_transport->Stop();
 	}
 
@@ -253,6 +272,44 @@ const std::shared_ptr<http::svr::ws::WebSocketSession>& RtcSession::GetWSClient(
 	return _ws_session;
 }
 
+SrtpStatistics RtcSession::GetSrtpStatistics() const
+{
+	if (_srtp_transport == nullptr)
+	{
+		return SrtpStatistics();
+	}
+
+	return _srtp_transport->GetSendStatistics();
+}
+
+void RtcSession::ReportSrtpStatistics(uint64_t now_ms)
+{
+	_last_srtp_report_ms = now_ms;
+
+	auto srtp_statistics = GetSrtpStatistics();
+
+	if (srtp_statistics.protect_count <= _reported_srtp_statistics.protect_count)
+	{
+		return;
+	}
+
+	auto stream = GetStream();
+	if (stream == nullptr)
+	{
+		return;
+	}
+
+	auto stream_metrics = StreamMetrics(*stream);
+	if (stream_metrics != nullptr)
+	{
+		stream_metrics->OnSrtpProtected(srtp_statistics.protect_count - _reported_srtp_statistics.protect_count,
+										srtp_statistics.protect_bytes - _reported_srtp_statistics.protect_bytes,
+										srtp_statistics.protect_time_ns - _reported_srtp_statistics.protect_time_ns);
+	}
+
+	_reported_srtp_statistics = srtp_statistics;
+}
+
 bool RtcSession::RequestChangeRendition(const ov::String &rendition_name)
 {
 	auto rendition = _playlist->GetRendition(rendition_name);
@@ -476,6 +533,28 @@ bool RtcSession::IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_pa
 
 void RtcSession::SendOutgoingData(const std::any &packet)
 {
+	std::shared_ptr<RtpPacket> session_packet;
+
+	try 
+	{
+        session_packet = std::any_cast<std::shared_ptr<RtpPacket>>(packet);
+    }
+    catch(const std::bad_any_cast& e) 
+	{
+        logtd("An incorrect type of packet was input from the stream.");
+		return;
+    }
+
+	SendOutgoingPacket(session_packet);
+}
+
+void RtcSession::SendOutgoingPacket(const std::shared_ptr<RtpPacket> &session_packet)
+{
+	if(session_packet == nullptr)
+	{
+		return;
+	}
+
 	// ABR Test Codes
 	// if (_changed == false && _abr_test_watch.IsElapsed(5000))
 	// {
@@ -504,78 +583,104 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	std::shared_ptr<RtpPacket> session_packet;
-
-	try 
-	{
-        session_packet = std::any_cast<std::shared_ptr<RtpPacket>>(packet);
-		if(session_packet == nullptr)
-		{
-			return;
-		}
-    }
-    catch(const std::bad_any_cast& e) 
-	{
-        logtd("An incorrect type of packet was input from the stream.");
-		return;
-    }
-
 	// Check the packet is selected.
 	if (IsSelectedPacket(session_packet) == false)
 	{
 		return;
 	}
 
-	// RTP Session must be copied and sent because data is altered due to SRTP.
-	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
+	uint16_t sequence_number = session_packet->IsVideoPacket() ? _video_rtp_sequence_number++ : _audio_rtp_sequence_number++;
+	auto now_ms = ov::Clock::NowMSec();
 
-	if (copy_packet->IsVideoPacket())
+	std::shared_ptr<ov::Data> sent_data;
+
+	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
+
+	if (_zero_copy_fan_out == true)
 	{
-		copy_packet->SetSequenceNumber(_video_rtp_sequence_number++);
+		// The packet is shared with other sessions, so only this session's buffer is altered by the header rewriting and SRTP.
+		auto source_data = session_packet->GetData();
+		auto fan_out_buffer = GetFanOutBuffer();
+		if (fan_out_buffer->SetLength(source_data->GetLength()) == false)
+		{
+			return;
+		}
+
+		auto rtp_buffer = fan_out_buffer->GetWritableDataAs<uint8_t>();
+		::memcpy(rtp_buffer, source_data->GetData(), source_data->GetLength());
+
+		ByteWriter<uint16_t>::WriteBigEndian(&rtp_buffer[2], sequence_number);
+		SetTransportWideSequenceNumber(session_packet, rtp_buffer, _wide_sequence_number);
+		SetAbsSendTime(session_packet, rtp_buffer, now_ms);
+
+		_rtp_rtcp->SendRtpPacket(session_packet, fan_out_buffer);
+
+		sent_data = fan_out_buffer;
 	}
 	else
 	{
-		copy_packet->SetSequenceNumber(_audio_rtp_sequence_number++);
+		// RTP Session must be copied and sent because data is altered due to SRTP.
+		auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
+
+		copy_packet->SetSequenceNumber(sequence_number);
+		SetTransportWideSequenceNumber(copy_packet, copy_packet->Header(), _wide_sequence_number);
+		SetAbsSendTime(copy_packet, copy_packet->Header(), now_ms);
+
+		// Packet loss simulation codes
+		// if (ov::Random::GenerateUInt32(1, 33) != 10)
+		{
+			_rtp_rtcp->SendRtpPacket(copy_packet);
+		}
+
+		sent_data = copy_packet->GetData();
 	}
 
-	// Set transport-wide sequence number
-	SetTransportWideSequenceNumber(copy_packet, _wide_sequence_number);
-	SetAbsSendTime(copy_packet, ov::Clock::NowMSec());
+	RecordRtpSent(session_packet, sequence_number, session_packet->SequenceNumber(), _wide_sequence_number, sent_data->GetLength());
 
-	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
+	_wide_sequence_number ++;
+
+	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, sent_data->GetLength());
 
-	// Packet loss simulation codes
-	// if (ov::Random::GenerateUInt32(1, 33) != 10)
+	if ((now_ms - _last_srtp_report_ms) >= RTC_SESSION_SRTP_STATISTICS_REPORT_INTERVAL_MS)
 	{
-		_rtp_rtcp->SendRtpPacket(copy_packet);
+		ReportSrtpStatistics(now_ms);
 	}
+}
 
-	RecordRtpSent(copy_packet, session_packet->SequenceNumber(), _wide_sequence_number);
+std::shared_ptr<ov::Data> RtcSession::GetFanOutBuffer()
+{
+	auto &buffer = _rtp_fan_out_buffers[_rtp_fan_out_buffer_index];
+	_rtp_fan_out_buffer_index = (_rtp_fan_out_buffer_index + 1) % _rtp_fan_out_buffers.size();
 
-	_wide_sequence_number ++;
+	// If the buffer is still referenced (e.g. queued in the socket for the batched egress), writing to it would detach (copy) it anyway,
+	// so it is left to the holder and a new one takes its place. Once sends complete in time, no allocation is made.
+	if ((buffer == nullptr) || (buffer.use_count() > 1))
+	{
+		buffer = std::make_shared<ov::Data>(RTP_DEFAULT_MAX_PACKET_SIZE);
+	}
 
-	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetData()->GetLength());
+	return buffer;
 }
 
-bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
+bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *rtp_buffer, uint16_t wide_sequence_number)
 {
-	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID);
-	if (extension_buffer == nullptr)
+	auto extension_offset = rtp_packet->ExtensionOffset(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID);
+	if (extension_offset < 0)
 	{
 		return false;
 	}
 
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
 	
-	ByteWriter<uint16_t>::WriteBigEndian(extension_buffer + payload_offset, wide_sequence_number);
+	ByteWriter<uint16_t>::WriteBigEndian(rtp_buffer + extension_offset + payload_offset, wide_sequence_number);
 
 	return true;
 }
 
-bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms)
+bool RtcSession::SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *rtp_buffer, uint64_t time_ms)
 {
-	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID);
-	if (extension_buffer == nullptr)
+	auto extension_offset = rtp_packet->ExtensionOffset(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID);
+	if (extension_offset < 0)
 	{
 		return false;
 	}
@@ -583,12 +688,12 @@ bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, ui
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
 
 	auto abs_send_time = RtpHeaderExtensionAbsSendTime::MsToAbsSendTime(time_ms);
-	ByteWriter<uint24_t>::WriteBigEndian(extension_buffer + payload_offset, abs_send_time);
+	ByteWriter<uint24_t>::WriteBigEndian(rtp_buffer + extension_offset + payload_offset, abs_send_time);
 
 	return true;
 }
 
-bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number)
+bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t origin_sequence_number, uint16_t wide_sequence_number, size_t sent_bytes)
 {
 	if (rtp_packet == nullptr)
 	{
@@ -596,7 +701,7 @@ bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packe
 	}
 
 	auto sent_log = std::make_shared<RtpSentLog>();
-	sent_log->_sequence_number = rtp_packet->SequenceNumber();
+	sent_log->_sequence_number = sequence_number;
 	sent_log->_wide_sequence_number = wide_sequence_number;
 	sent_log->_track_id = rtp_packet->GetTrackId();
 	sent_log->_payload_type = rtp_packet->PayloadType();
@@ -605,7 +710,7 @@ bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packe
 	sent_log->_marker = rtp_packet->Marker();
 	sent_log->_ssrc = rtp_packet->Ssrc();
 
-	sent_log->_sent_bytes = rtp_packet->GetData()->GetLength();
+	sent_log->_sent_bytes = sent_bytes;
 	sent_log->_sent_time = std::chrono::system_clock::now();
 
 	auto video_rtp_key = sent_log->_sequence_number % MAX_RTP_RECORDS;
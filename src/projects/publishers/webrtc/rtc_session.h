@@ -21,6 +21,11 @@
 
 #include "rtc_playlist.h"
 
+// The SRTP statistics of a session are added to the stream metrics at this interval (and when the session is stopped)
+#define RTC_SESSION_SRTP_STATISTICS_REPORT_INTERVAL_MS 1000
+// Number of buffers used in turn for the zero-copy fan-out (a buffer is reused only when the previous send has released it)
+#define RTC_SESSION_FAN_OUT_BUFFER_COUNT 8
+
 /*	Node Connection
  * [  RTP_RTCP ]
  * [SRTP] [SCTP]				
@@ -82,6 +87,8 @@ public:
 
 	// pub::Session Interface
 	void SendOutgoingData(const std::any &packet) override;
+	// Called by RtcStream::BroadcastTypedPacket() without std::any_cast
+	void SendOutgoingPacket(const std::shared_ptr<RtpPacket> &session_packet);
 	void OnMessageReceived(const std::any &message) override;
 	
 	// RtpRtcp Interface
@@ -97,7 +104,15 @@ public:
 		return _ice_session_id;
 	}
 
+	// Encryption cost of this session (SRTP protect count/time)
+	SrtpStatistics GetSrtpStatistics() const;
+
 private:
+	// Adds the SRTP statistics since the last report to the stream metrics
+	void ReportSrtpStatistics(uint64_t now_ms);
+	SrtpStatistics _reported_srtp_statistics;
+	uint64_t _last_srtp_report_ms = 0;
+
 	bool ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info);
@@ -174,7 +189,7 @@ private:
 		}
 	};
 
-	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number);
+	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t origin_sequence_number, uint16_t wide_sequence_number, size_t sent_bytes);
 
 	std::shared_mutex _rtp_record_map_lock;
 	// For NACK
@@ -187,8 +202,17 @@ private:
 	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
 	std::shared_ptr<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
 
-	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
-	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
+	// rtp_buffer is the serialized data of rtp_packet (or a copy of it) to be written
+	bool SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *rtp_buffer, uint16_t wide_sequence_number);
+	bool SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *rtp_buffer, uint64_t time_ms);
+
+	// Zero-copy fan-out
+	// The packet from the stream is shared by all sessions and is never modified.
+	// Each session copies it into one of _rtp_fan_out_buffers, rewrites the header and protects it with SRTP there.
+	std::shared_ptr<ov::Data> GetFanOutBuffer();
+	bool _zero_copy_fan_out = true;
+	std::vector<std::shared_ptr<ov::Data>> _rtp_fan_out_buffers;
+	size_t _rtp_fan_out_buffer_index = 0;
 
 	// For Estimated bitrate
 	double _total_sent_seconds = 0;
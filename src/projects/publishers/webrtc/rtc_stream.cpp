@@ -97,6 +97,8 @@ RtcStream::RtcStream(const std::shared_ptr<pub::Application> application,
 {
 	_certificate = application->GetSharedPtrAs<RtcApplication>()->GetCertificate();
 	_vp8_picture_id = 0x8000;  // 1 {000 0000 0000 0000} 1 is marker for 15 bit length
+
+	RegisterPacketType<RtcSession, RtpPacket>();
 }
 
 RtcStream::~RtcStream()
@@ -122,6 +124,8 @@ bool RtcStream::Start()
 	_rtx_enabled = webrtc_config.IsRtxEnabled();
 	_ulpfec_enabled = webrtc_config.IsUlpfecEnalbed();
 	_jitter_buffer_enabled = webrtc_config.IsJitterBufferEnabled();
+	_zero_copy_fan_out_enabled = webrtc_config.IsZeroCopyFanOutEnabled();
+	_aes_gcm_preferred = webrtc_config.IsAesGcmPreferred();
 
 	auto playoutDelay = webrtc_config.GetPlayoutDelay(&_playout_delay_enabled);
 	_playout_delay_min = playoutDelay.GetMin();
@@ -195,11 +199,13 @@ bool RtcStream::Start()
 	std::lock_guard<std::shared_mutex> lock(_rtc_master_playlist_map_lock);
 	_rtc_master_playlist_map[_default_playlist_name] = rtc_master_playlist;
 
-	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s) JitterBuffer(%s) PlayoutDelay(%s min:%d max: %d)",
+	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s) JitterBuffer(%s) ZeroCopyFanOut(%s) PreferAesGcm(%s) PlayoutDelay(%s min:%d max: %d)",
 		  GetName().CStr(), GetId(),
 		  ov::Converter::ToString(_rtx_enabled).CStr(),
 		  ov::Converter::ToString(_ulpfec_enabled).CStr(),
 		  ov::Converter::ToString(_jitter_buffer_enabled).CStr(),
+		  ov::Converter::ToString(_zero_copy_fan_out_enabled).CStr(),
+		  ov::Converter::ToString(_aes_gcm_preferred).CStr(),
 		  ov::Converter::ToString(_playout_delay_enabled).CStr(),
 		  _playout_delay_min, _playout_delay_max);
 
@@ -640,8 +646,7 @@ std::shared_ptr<PayloadAttr> RtcStream::MakeRtxPayloadAttr(const std::shared_ptr
 
 bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 {
-	auto stream_packet = std::make_any<std::shared_ptr<RtpPacket>>(packet);
-	BroadcastPacket(stream_packet);
+	BroadcastTypedPacket(packet);
 
 	if (_rtx_enabled == true)
 	{
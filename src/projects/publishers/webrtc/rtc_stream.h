@@ -42,6 +42,16 @@ public:
 
 	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number);
 
+	bool IsZeroCopyFanOutEnabled() const
+	{
+		return _zero_copy_fan_out_enabled;
+	}
+
+	bool IsAesGcmPreferred() const
+	{
+		return _aes_gcm_preferred;
+	}
+
 	// RtpRtcpPacketizerInterface Implementation
 	bool OnRtpPacketized(std::shared_ptr<RtpPacket> packet) override;
 
@@ -105,6 +115,8 @@ private:
 	bool _rtx_enabled = true;
 	bool _ulpfec_enabled = true;
 	bool _jitter_buffer_enabled = false;
+	bool _zero_copy_fan_out_enabled = true;
+	bool _aes_gcm_preferred = true;
 	bool _playout_delay_enabled = false;
 	int _playout_delay_min = 0;
 	int _playout_delay_max = 0;
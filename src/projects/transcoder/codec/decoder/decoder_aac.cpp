@@ -50,20 +50,10 @@ bool DecoderAAC::Configure(std::shared_ptr<MediaTrack> context)
 
 	_parser->flags |= PARSER_FLAG_COMPLETE_FRAMES;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
+	// Registers a job that reads and encodes frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
 
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start decoder thread");
-		_kill_flag = true;
-		return false;
-	}
+	StartJob();
 
 	return true;
 }
@@ -79,10 +69,11 @@ void DecoderAAC::CodecThread()
 		/////////////////////////////////////////////////////////////////////
 		if (_cur_pkt == nullptr && (_input_buffer.IsEmpty() == false || no_data_to_encode == true))
 		{
-			auto obj = _input_buffer.Dequeue();
+			auto obj = _input_buffer.Dequeue(0);
 			if (obj.has_value() == false)
 			{
-				continue;
+				// No more input. The job is run again when a new input is enqueued
+				break;
 			}
 
 			no_data_to_encode = false;
@@ -57,20 +57,10 @@ bool DecoderAVC::Configure(std::shared_ptr<MediaTrack> context)
 
 	_parser->flags |= PARSER_FLAG_COMPLETE_FRAMES;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
+	// Registers a job that reads and encodes frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
 
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start decoder thread");
-		_kill_flag = true;
-		return false;
-	}
+	StartJob();
 
 	return true;
 }
@@ -79,11 +69,11 @@ void DecoderAVC::CodecThread()
 {
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
+		auto obj = _input_buffer.Dequeue(0);
 		if (obj.has_value() == false)
 		{
-			// logte("An error occurred while dequeue : no data");
-			continue;
+			// No more input. The job is run again when a new input is enqueued
+			break;
 		}
 
 		auto buffer = std::move(obj.value());
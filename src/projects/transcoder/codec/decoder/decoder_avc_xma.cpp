@@ -36,20 +36,10 @@ bool DecoderAVCxXMA::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	try
-	{
-		_kill_flag = false;
+	_kill_flag = false;
 
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%sXMA", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start decoder thread");
-		_kill_flag = true;
-
-		return false;
-	}
+	// The XMA session is always used by the same thread
+	StartJob(true);
 
 	return true;
 }
@@ -136,11 +126,11 @@ void DecoderAVCxXMA::CodecThread()
 {
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
+		auto obj = _input_buffer.Dequeue(0);
 		if (obj.has_value() == false)
 		{
-			// logte("An error occurred while dequeue : no data");
-			continue;
+			// No more input. The job is run again when a new input is enqueued
+			break;
 		}
 
 		auto buffer = std::move(obj.value());
@@ -59,21 +59,10 @@ bool EncoderAAC::Configure(std::shared_ptr<MediaTrack> context)
 
 	GetRefTrack()->SetAudioSamplesPerFrame(_codec_context->frame_size);
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
+	// Registers a job that reads and encodes frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
 
-		_codec_thread = std::thread(&EncoderAAC::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
-		return false;
-	}
+	StartJob();
 
 	return true;
 }
@@ -82,9 +71,12 @@ void EncoderAAC::CodecThread()
 {
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
+		auto obj = _input_buffer.Dequeue(0);
 		if (obj.has_value() == false)
-			continue;
+		{
+			// No more input. The job is run again when a new input is enqueued
+			break;
+		}
 
 		auto media_frame = std::move(obj.value());
 
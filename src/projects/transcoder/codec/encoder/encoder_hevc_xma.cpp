@@ -71,59 +71,60 @@ bool EncoderHEVCxXMA::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 	
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
+	// Registers a job that reads and encodes frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
 
-		_codec_thread = std::thread(&TranscodeEncoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
-		return false;
-	}
+	// The XMA session is always used by the same thread
+	StartJob(true);
 
 	return true;
 }
 
 void EncoderHEVCxXMA::CodecThread()
 {
-	ov::String codec_name = "mpsoc_vcu_hevc";
-	const AVCodec *codec = ::avcodec_find_encoder_by_name(codec_name.CStr());
-	if (codec == nullptr)
-	{
-		logte("Could not find encoder: %s", codec_name.CStr());
-		return ;
-	}
-
-	_codec_context = ::avcodec_alloc_context3(codec);
+	// The codec is opened by the pinned worker on the first run
 	if (_codec_context == nullptr)
 	{
-		logte("Could not allocate codec context for %s", codec_name.CStr());
-		return ;
-	}
+		ov::String codec_name = "mpsoc_vcu_hevc";
+		const AVCodec *codec = ::avcodec_find_encoder_by_name(codec_name.CStr());
+		if (codec == nullptr)
+		{
+			logte("Could not find encoder: %s", codec_name.CStr());
+			_kill_flag = true;
+			return;
+		}
 
-	if (SetCodecParams() == false)
-	{
-		logte("Could not set codec parameters for %s", codec_name.CStr());
-		return ;
-	}
+		_codec_context = ::avcodec_alloc_context3(codec);
+		if (_codec_context == nullptr)
+		{
+			logte("Could not allocate codec context for %s", codec_name.CStr());
+			_kill_flag = true;
+			return;
+		}
 
-	if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
-	{
-		logte("Could not open codec: %s", codec_name.CStr());
-		return ;
+		if (SetCodecParams() == false)
+		{
+			logte("Could not set codec parameters for %s", codec_name.CStr());
+			_kill_flag = true;
+			return;
+		}
+
+		if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
+		{
+			logte("Could not open codec: %s", codec_name.CStr());
+			_kill_flag = true;
+			return;
+		}
 	}
 
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
+		auto obj = _input_buffer.Dequeue(0);
 		if (obj.has_value() == false)
-			continue;
+		{
+			// No more input. The job is run again when a new input is enqueued
+			break;
+		}
 
 		auto media_frame = std::move(obj.value());
 
@@ -115,21 +115,10 @@ bool EncoderOPUS::Configure(std::shared_ptr<MediaTrack> context)
 	_format = cmn::AudioSample::Format::None;
 	_current_pts = -1;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
+	// Registers a job that reads and encodes frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
 
-		_codec_thread = std::thread(&EncoderOPUS::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
-		return false;
-	}
+	StartJob();
 
 	return true;
 }
@@ -147,9 +136,12 @@ void EncoderOPUS::CodecThread()
 		// If there is no data to encode, the data is fetched from the queue.
 		if (_buffer->GetLength() < bytes_to_encode)
 		{
-			auto obj = _input_buffer.Dequeue();
+			auto obj = _input_buffer.Dequeue(0);
 			if (obj.has_value() == false)
-				continue;
+			{
+				// No more input. The job is run again when a new input is enqueued
+				break;
+			}
 
 			auto media_frame = std::move(obj.value());
 			OV_ASSERT2(media_frame != nullptr);
@@ -97,20 +97,9 @@ bool EncoderVP8::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	try
-	{
-		_kill_flag = false;
+	_kill_flag = false;
 
-		_codec_thread = std::thread(&EncoderVP8::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
-		return false;
-	}
+	StartJob();
 
 	return true;
 }
@@ -119,9 +108,12 @@ void EncoderVP8::CodecThread()
 {
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
+		auto obj = _input_buffer.Dequeue(0);
 		if (obj.has_value() == false)
-			continue;
+		{
+			// No more input. The job is run again when a new input is enqueued
+			break;
+		}
 
 		auto media_frame = std::move(obj.value());
 
@@ -17,6 +17,7 @@
 
 #include "../codec/codec_base.h"
 #include "../transcoder_context.h"
+#include "../transcoder_thread_pool.h"
 
 #include <base/info/application.h>
 #include <base/info/media_track.h>
@@ -35,7 +36,8 @@ public:
 		ERROR
 	};
 
-	typedef std::function<void(std::shared_ptr<MediaFrame>)> CompleteHandler;
+	// output_index: index of the output track (always 0 except for the multi-output filters)
+	typedef std::function<void(int32_t output_index, std::shared_ptr<MediaFrame>)> CompleteHandler;
 	FilterBase() = default;
 	virtual ~FilterBase() = default;
 
@@ -71,6 +73,11 @@ public:
 		_input_buffer.SetUrn(urn);
 	}
 
+	// The filters of a stream are run by the same worker of the thread pool if possible
+	void SetStreamId(info::stream_id_t stream_id) {
+		_stream_id = stream_id;
+	}
+
 	void SetState(State state)
 	{
 		_state = state;
@@ -87,6 +94,11 @@ public:
 		{
 			_input_buffer.Enqueue(std::move(buffer));
 
+			if (_job != nullptr)
+			{
+				_job->Schedule();
+			}
+
 			return true;
 		}
 
@@ -94,6 +106,23 @@ public:
 	}
 
 protected:
+	// Registers the task to the filter thread pool. The task is run whenever a frame is enqueued.
+	void StartJob(std::function<void()> task)
+	{
+		_job = TranscoderThreadPool::GetInstance(TranscoderThreadPool::Stage::Filter)->CreateJob(_stream_id, false, std::move(task));
+
+		// Processes the frames that are enqueued before the job is registered
+		_job->Schedule();
+	}
+
+	// Waits until the running task returns
+	void StopJob()
+	{
+		if (_job != nullptr)
+		{
+			_job->Cancel();
+		}
+	}
 
 	std::atomic<State> _state = State::CREATED;
 
@@ -115,8 +144,10 @@ protected:
 	std::shared_ptr<MediaTrack> _input_track;
 	std::shared_ptr<MediaTrack> _output_track;
 
+	info::stream_id_t _stream_id = 0;
+
 	bool _kill_flag = false;
-	std::thread _thread_work;
+	std::shared_ptr<TranscoderThreadPool::Job> _job;
 
 	CompleteHandler _complete_handler;
 };
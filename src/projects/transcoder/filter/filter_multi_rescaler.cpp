@@ -0,0 +1,431 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "filter_multi_rescaler.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "../transcoder_private.h"
+
+#define MAX_QUEUE_SIZE 500
+
+FilterMultiRescaler::FilterMultiRescaler(bool cascade)
+	: _cascade(cascade)
+{
+	_frame = ::av_frame_alloc();
+
+	_input_buffer.SetThreshold(MAX_QUEUE_SIZE);
+
+	OV_ASSERT2(_frame != nullptr);
+}
+
+FilterMultiRescaler::~FilterMultiRescaler()
+{
+	Stop();
+
+	OV_SAFE_FUNC(_frame, nullptr, ::av_frame_free, &);
+
+	OV_SAFE_FUNC(_inputs, nullptr, ::avfilter_inout_free, &);
+	OV_SAFE_FUNC(_outputs, nullptr, ::avfilter_inout_free, &);
+
+	OV_SAFE_FUNC(_filter_graph, nullptr, ::avfilter_graph_free, &);
+
+	_input_buffer.Clear();
+}
+
+bool FilterMultiRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track)
+{
+	return Configure(input_track, std::vector<std::shared_ptr<MediaTrack>>{output_track});
+}
+
+bool FilterMultiRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks)
+{
+	SetState(State::CREATED);
+
+	if (output_tracks.empty())
+	{
+		logte("There is no output track for rescaling");
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	_input_track = input_track;
+	_output_track = output_tracks.front();
+	_output_tracks = output_tracks;
+
+	const AVFilter *buffersrc = ::avfilter_get_by_name("buffer");
+	const AVFilter *buffersink = ::avfilter_get_by_name("buffersink");
+	int ret;
+	_filter_graph = ::avfilter_graph_alloc();
+	_outputs = ::avfilter_inout_alloc();
+
+	if ((_filter_graph == nullptr) || (_outputs == nullptr))
+	{
+		logte("Could not allocate variables for filter graph: %p, %p", _filter_graph, _outputs);
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	// Limit the number of filter threads to 4. I think 4 thread is usually enough for video filtering processing.
+	_filter_graph->nb_threads = 4;
+
+	AVRational input_timebase = ffmpeg::Conv::TimebaseToAVRational(input_track->GetTimeBase());
+
+	for (auto &output_track : _output_tracks)
+	{
+		AVRational output_timebase = ffmpeg::Conv::TimebaseToAVRational(output_track->GetTimeBase());
+
+		if (::isnan(::av_q2d(::av_div_q(input_timebase, output_timebase))))
+		{
+			logte("Invalid timebase: input: %d/%d, output: %d/%d",
+				  input_timebase.num, input_timebase.den,
+				  output_timebase.num, output_timebase.den);
+
+			SetState(State::ERROR);
+
+			return false;
+		}
+	}
+
+	//////////////////////////////////////////////////////
+	// Prepare the input parameters
+	//////////////////////////////////////////////////////
+	std::vector<ov::String> src_params = {
+		ov::String::FormatString("video_size=%dx%d", input_track->GetWidth(), input_track->GetHeight()),
+		ov::String::FormatString("pix_fmt=%d", input_track->GetColorspace()),
+		ov::String::FormatString("time_base=%s", input_track->GetTimeBase().GetStringExpr().CStr()),
+		ov::String::FormatString("pixel_aspect=%d/%d", 1, 1)};
+
+	ov::String input_filters = ov::String::Join(src_params, ":");
+
+	ret = ::avfilter_graph_create_filter(&_buffersrc_ctx, buffersrc, "in", input_filters, nullptr, _filter_graph);
+	if (ret < 0)
+	{
+		logte("Could not create video buffer source filter for rescaling: %d", ret);
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	//////////////////////////////////////////////////////
+	// Prepare output filters (a buffersink per output track)
+	//////////////////////////////////////////////////////
+	_buffersink_ctxs.clear();
+
+	for (size_t index = 0; index < _output_tracks.size(); index++)
+	{
+		AVFilterContext *buffersink_ctx = nullptr;
+		auto name = ov::String::FormatString("out%zu", index);
+
+		ret = ::avfilter_graph_create_filter(&buffersink_ctx, buffersink, name, nullptr, nullptr, _filter_graph);
+		if (ret < 0)
+		{
+			logte("Could not create video buffer sink filter for rescaling: %d", ret);
+
+			SetState(State::ERROR);
+
+			return false;
+		}
+
+		enum AVPixelFormat pix_fmts[] = {(AVPixelFormat)_output_tracks[index]->GetColorspace(), AV_PIX_FMT_NONE};
+		ret = av_opt_set_int_list(buffersink_ctx, "pix_fmts", pix_fmts, AV_PIX_FMT_NONE, AV_OPT_SEARCH_CHILDREN);
+		if (ret < 0)
+		{
+			logte("Could not set output pixel format for rescaling: %d", ret);
+
+			SetState(State::ERROR);
+
+			return false;
+		}
+
+		_buffersink_ctxs.push_back(buffersink_ctx);
+	}
+
+	ov::String output_filters = MakeFilterGraphString();
+
+	//////////////////////////////////////////////////////
+	// Build
+	//////////////////////////////////////////////////////
+	_outputs->name = ::av_strdup("in");
+	_outputs->filter_ctx = _buffersrc_ctx;
+	_outputs->pad_idx = 0;
+	_outputs->next = nullptr;
+
+	// Link the buffersinks in reverse order to keep the list in the order of the outputs
+	for (auto index = _buffersink_ctxs.size(); index > 0; index--)
+	{
+		auto input = ::avfilter_inout_alloc();
+		if (input == nullptr)
+		{
+			logte("Could not allocate variables for filter graph");
+
+			SetState(State::ERROR);
+
+			return false;
+		}
+
+		input->name = ::av_strdup(ov::String::FormatString("out%zu", index - 1));
+		input->filter_ctx = _buffersink_ctxs[index - 1];
+		input->pad_idx = 0;
+		input->next = _inputs;
+
+		_inputs = input;
+	}
+
+	logti("Multi-output rescaler is enabled for track #%u -> %zu tracks (cascade: %s). input: %s / outputs: %s",
+		  input_track->GetId(), _output_tracks.size(), _cascade ? "true" : "false", input_filters.CStr(), output_filters.CStr());
+
+	if ((ret = ::avfilter_graph_parse_ptr(_filter_graph, output_filters, &_inputs, &_outputs, nullptr)) < 0)
+	{
+		logte("Could not parse filter string for rescaling: %d (%s)", ret, output_filters.CStr());
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	_input_width = input_track->GetWidth();
+	_input_height = input_track->GetHeight();
+
+	if ((ret = ::avfilter_graph_config(_filter_graph, nullptr)) < 0)
+	{
+		logte("Could not validate filter graph for rescaling: %d", ret);
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	return true;
+}
+
+ov::String FilterMultiRescaler::MakeFilterGraphString() const
+{
+	auto output_count = _output_tracks.size();
+
+	// The rendition that each rendition is scaled from (-1: the source frame)
+	std::vector<int> parents(output_count, -1);
+
+	if (_cascade)
+	{
+		// From the largest rendition
+		std::vector<size_t> order(output_count);
+		for (size_t index = 0; index < output_count; index++)
+		{
+			order[index] = index;
+		}
+
+		std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) -> bool {
+			return (static_cast<int64_t>(_output_tracks[a]->GetWidth()) * _output_tracks[a]->GetHeight()) >
+				   (static_cast<int64_t>(_output_tracks[b]->GetWidth()) * _output_tracks[b]->GetHeight());
+		});
+
+		for (size_t position = 1; position < output_count; position++)
+		{
+			auto &larger = _output_tracks[order[position - 1]];
+			auto &current = _output_tracks[order[position]];
+
+			// Scale from the next larger rendition only when it is a downscale in both directions
+			if ((current->GetWidth() <= larger->GetWidth()) && (current->GetHeight() <= larger->GetHeight()))
+			{
+				parents[order[position]] = static_cast<int>(order[position - 1]);
+			}
+		}
+	}
+
+	auto get_children = [&](int parent) -> std::vector<size_t> {
+		std::vector<size_t> children;
+
+		for (size_t index = 0; index < output_count; index++)
+		{
+			if (parents[index] == parent)
+			{
+				children.push_back(index);
+			}
+		}
+
+		return children;
+	};
+
+	auto make_split = [](const ov::String &own_label, const std::vector<size_t> &children) -> ov::String {
+		ov::String split = ov::String::FormatString("split=%zu%s", children.size() + (own_label.IsEmpty() ? 0 : 1), own_label.CStr());
+
+		for (auto child : children)
+		{
+			split.AppendFormat("[in%zu]", child);
+		}
+
+		return split;
+	};
+
+	std::vector<ov::String> chains;
+
+	// 1. Source: convert the pixel format once if all the outputs use the same format
+	ov::String source_chain = "[in]";
+	auto colorspace = _output_tracks.front()->GetColorspace();
+	bool same_colorspace = std::all_of(_output_tracks.begin(), _output_tracks.end(), [colorspace](const std::shared_ptr<MediaTrack> &track) -> bool {
+		return track->GetColorspace() == colorspace;
+	});
+
+	if (same_colorspace)
+	{
+		auto pix_fmt_name = ::av_get_pix_fmt_name(static_cast<AVPixelFormat>(colorspace));
+
+		if (pix_fmt_name != nullptr)
+		{
+			source_chain.AppendFormat("format=pix_fmts=%s,", pix_fmt_name);
+		}
+	}
+
+	source_chain.Append(make_split("", get_children(-1)));
+	chains.push_back(source_chain);
+
+	// 2. Renditions
+	for (size_t index = 0; index < output_count; index++)
+	{
+		auto &output_track = _output_tracks[index];
+		auto children = get_children(static_cast<int>(index));
+
+		ov::String fps_filter;
+		if (output_track->GetFrameRateByConfig() > 0.0f)
+		{
+			fps_filter = ov::String::FormatString("fps=fps=%.2f:round=near,", output_track->GetFrameRateByConfig());
+		}
+
+		auto scale_filter = ov::String::FormatString("scale=%dx%d:flags=bilinear", output_track->GetWidth(), output_track->GetHeight());
+		auto settb_filter = ov::String::FormatString("settb=%s", output_track->GetTimeBase().GetStringExpr().CStr());
+
+		if (children.empty())
+		{
+			// [in#] -> [fps] -> [scale] -> [settb] -> [out#]
+			chains.push_back(ov::String::FormatString("[in%zu]%s%s,%s[out%zu]", index, fps_filter.CStr(), scale_filter.CStr(), settb_filter.CStr(), index));
+		}
+		else
+		{
+			// The frame rate is changed after splitting, because the smaller renditions are scaled from this rendition
+			//     [in#] -> [scale] -> [split] -> [fps] -> [settb] -> [out#]
+			//                                 -> [in(child)]
+			auto own_label = ov::String::FormatString("[own%zu]", index);
+
+			chains.push_back(ov::String::FormatString("[in%zu]%s,%s", index, scale_filter.CStr(), make_split(own_label, children).CStr()));
+			chains.push_back(ov::String::FormatString("%s%s%s[out%zu]", own_label.CStr(), fps_filter.CStr(), settb_filter.CStr(), index));
+		}
+	}
+
+	return ov::String::Join(chains, ";");
+}
+
+bool FilterMultiRescaler::Start()
+{
+	// Registers a job that reads and filters frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
+
+	SetState(State::STARTED);
+
+	StartJob([this]() {
+		WorkerThread();
+	});
+
+	return true;
+}
+
+void FilterMultiRescaler::Stop()
+{
+	_kill_flag = true;
+
+	_input_buffer.Stop();
+
+	StopJob();
+
+	SetState(State::STOPPED);
+}
+
+void FilterMultiRescaler::WorkerThread()
+{
+	int ret;
+
+	while (!_kill_flag)
+	{
+		auto obj = _input_buffer.Dequeue(0);
+		if (obj.has_value() == false)
+		{
+			// No more input. The job is run again when a new input is enqueued
+			break;
+		}
+
+		auto media_frame = std::move(obj.value());
+
+		// The source frame is fed only once for all the outputs
+		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+		if (!av_frame)
+		{
+			logte("Could not allocate the video frame data");
+
+			SetState(State::ERROR);
+
+			break;
+		}
+
+		ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
+		if (ret < 0)
+		{
+			logte("An error occurred while feeding to filtergraph: format: %d, pts: %lld, linesize: %d, queue.size: %d", av_frame->format, av_frame->pts, av_frame->linesize[0], _input_buffer.Size());
+
+			continue;
+		}
+
+		for (size_t index = 0; (index < _buffersink_ctxs.size()) && (_kill_flag == false); index++)
+		{
+			while (!_kill_flag)
+			{
+				ret = ::av_buffersink_get_frame(_buffersink_ctxs[index], _frame);
+				if (ret == AVERROR(EAGAIN))
+				{
+					break;
+				}
+				else if (ret == AVERROR_EOF)
+				{
+					logte("Error receiving filtered frame. error(EOF)");
+
+					SetState(State::ERROR);
+
+					break;
+				}
+				else if (ret < 0)
+				{
+					logte("Error receiving filtered frame. error(%d)", ret);
+
+					SetState(State::ERROR);
+
+					break;
+				}
+				else
+				{
+					_frame->pict_type = AV_PICTURE_TYPE_NONE;
+					auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
+					::av_frame_unref(_frame);
+					if (output_frame == nullptr)
+					{
+						continue;
+					}
+
+					if (_complete_handler != nullptr && _kill_flag == false)
+					{
+						_complete_handler(static_cast<int32_t>(index), std::move(output_frame));
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,47 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include "../transcoder_context.h"
+#include "base/mediarouter/media_buffer.h"
+#include "base/mediarouter/media_type.h"
+#include "filter_base.h"
+
+// Rescales a decoded frame to several output tracks (renditions) with one filter graph.
+// The source frame is fed once, and the pixel format is converted once if all the outputs use the same format.
+//
+// Filter graph:
+//     [buffer] -> [format] -> [split] -> [fps] -> [scale] -> [settb] -> [buffersink #0]
+//                                     -> [fps] -> [scale] -> [settb] -> [buffersink #1]
+//
+// In the cascade mode, a rendition is scaled from the next larger rendition that contains it:
+//     [buffer] -> [format] -> [scale 720p] -> [split] -> [fps] -> [settb] -> [buffersink #0]
+//                                                     -> [scale 480p] -> [split] -> ...
+class FilterMultiRescaler : public FilterBase
+{
+public:
+	FilterMultiRescaler(bool cascade);
+	~FilterMultiRescaler();
+
+	bool Configure(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track) override;
+	bool Configure(const std::shared_ptr<MediaTrack> &input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks);
+	bool Start() override;
+	void Stop() override;
+
+	void WorkerThread();
+
+protected:
+	ov::String MakeFilterGraphString() const;
+
+	bool _cascade = false;
+
+	std::vector<std::shared_ptr<MediaTrack>> _output_tracks;
+	std::vector<AVFilterContext *> _buffersink_ctxs;
+};
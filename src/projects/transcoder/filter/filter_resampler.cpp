@@ -170,24 +170,12 @@ bool FilterResampler::Configure(const std::shared_ptr<MediaTrack> &input_track,
 
 bool FilterResampler::Start()
 {
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
-
-		_thread_work = std::thread(&FilterResampler::WorkerThread, this);
-		pthread_setname_np(_thread_work.native_handle(), "Resampler");
-	}
-	catch (const std::system_error &e)
-	{
-		_kill_flag = true;
+	// Registers a job that reads and filters frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
 
-		SetState(State::ERROR);
-
-		logte("Failed to start resample filter thread.");
-
-		return false;
-	}
+	StartJob([this]() {
+		WorkerThread();
+	});
 
 	return true;
 }
@@ -198,28 +186,22 @@ void FilterResampler::Stop()
 
 	_input_buffer.Stop();
 
-	if (_thread_work.joinable())
-	{
-		_thread_work.join();
-
-		logtd("resampler filter thread has ended");
-	}
+	StopJob();
 
 	SetState(State::STOPPED);
 }
 
 void FilterResampler::WorkerThread()
 {
-	logtd("Start resampler filter thread.");
-
 	int ret;
 
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
+		auto obj = _input_buffer.Dequeue(0);
 		if (obj.has_value() == false)
 		{
-			continue;
+			// No more input. The job is run again when a new input is enqueued
+			break;
 		}
 
 		auto media_frame = std::move(obj.value());
@@ -279,7 +261,7 @@ void FilterResampler::WorkerThread()
 
 				if (_complete_handler != nullptr && _kill_flag == false)
 				{
-					_complete_handler(std::move(output_frame));
+					_complete_handler(0, std::move(output_frame));
 				}
 			}
 		}
@@ -261,23 +261,14 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 
 bool FilterRescaler::Start()
 {
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
-
-		_thread_work = std::thread(&FilterRescaler::WorkerThread, this);
-		pthread_setname_np(_thread_work.native_handle(), "Rescaler");
-	}
-	catch (const std::system_error &e)
-	{
-		_kill_flag = true;
-		SetState(State::ERROR);
+	// Registers a job that reads and filters frames in the input_buffer queue and places them in the output queue.
+	_kill_flag = false;
 
-		logte("Failed to start rescaling filter thread");
+	SetState(State::STARTED);
 
-		return false;
-	}
+	StartJob([this]() {
+		WorkerThread();
+	});
 
 	return true;
 }
@@ -288,28 +279,22 @@ void FilterRescaler::Stop()
 
 	_input_buffer.Stop();
 
-	if (_thread_work.joinable())
-	{
-		_thread_work.join();
-	}
+	StopJob();
 
 	SetState(State::STOPPED);
 }
 
 void FilterRescaler::WorkerThread()
 {
-	logtd("Start rescaling filter thread");
 	int ret;
 
-
-	SetState(State::STARTED);
-
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
+		auto obj = _input_buffer.Dequeue(0);
 		if (obj.has_value() == false)
 		{
-			continue;
+			// No more input. The job is run again when a new input is enqueued
+			break;
 		}
 
 		auto media_frame = std::move(obj.value());
@@ -367,7 +352,7 @@ void FilterRescaler::WorkerThread()
 
 				if (_complete_handler != nullptr && _kill_flag == false)
 				{
-					_complete_handler(std::move(output_frame));
+					_complete_handler(0, std::move(output_frame));
 				}
 			}
 		}
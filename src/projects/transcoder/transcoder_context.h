@@ -17,6 +17,7 @@ extern "C"
 #include <libavformat/avformat.h>
 }
 
+#include "base/mediarouter/media_trace.h"
 #include "base/mediarouter/media_type.h"
 
 class MediaFrame
@@ -52,6 +53,17 @@ public:
 		return _track_id;
 	}
 
+	// A frame has a trace only if it is made from a sampled packet (not copied by CloneFrame())
+	const std::shared_ptr<MediaTrace> &GetTrace() const
+	{
+		return _trace;
+	}
+
+	void SetTrace(const std::shared_ptr<MediaTrace> &trace)
+	{
+		_trace = trace;
+	}
+
 	int64_t GetPts() const
 	{
 		return _pts;
@@ -248,4 +260,6 @@ private:
 	int32_t _sample_rate = 0;
 
 	int32_t _flags = 0;	 // Key, non-Key
+
+	std::shared_ptr<MediaTrace> _trace;
 };
@@ -249,6 +249,11 @@ bool TranscodeDecoder::Configure(std::shared_ptr<MediaTrack> track)
 void TranscodeDecoder::SendBuffer(std::shared_ptr<const MediaPacket> packet)
 {
 	_input_buffer.Enqueue(std::move(packet));
+
+	if (_job != nullptr)
+	{
+		_job->Schedule();
+	}
 }
 
 void TranscodeDecoder::SendOutputBuffer(TranscodeResult result, std::shared_ptr<MediaFrame> frame)
@@ -267,10 +272,21 @@ void TranscodeDecoder::Stop()
 
 	_input_buffer.Stop();
 
-	if (_codec_thread.joinable())
+	if (_job != nullptr)
 	{
-		_codec_thread.join();
+		// Waits until the running CodecThread() returns
+		_job->Cancel();
 
-		logtd(ov::String::FormatString("decoder %s thread has ended", avcodec_get_name(GetCodecID())).CStr());
+		logtd("decoder %s job has been cancelled", avcodec_get_name(GetCodecID()));
 	}
+}
+
+void TranscodeDecoder::StartJob(bool pinned)
+{
+	_job = TranscoderThreadPool::GetInstance(TranscoderThreadPool::Stage::Decoder)->CreateJob(_stream_info.GetId(), pinned, [this]() {
+		CodecThread();
+	});
+
+	// Processes the packets that are enqueued before the job is registered
+	_job->Schedule();
 }
\ No newline at end of file
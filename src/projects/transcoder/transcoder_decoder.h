@@ -10,6 +10,7 @@
 
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
+#include "transcoder_thread_pool.h"
 
 class TranscodeDecoder : public TranscodeBase<MediaPacket, MediaFrame>
 {
@@ -42,6 +43,11 @@ public:
 		_complete_handler = move(complete_handler);
 	}
 
+protected:
+	// Registers CodecThread() to the decoder thread pool
+	// A pinned job is always run by the same thread (for the codecs whose context must be used in the same thread)
+	void StartJob(bool pinned = false);
+
 protected:
 	int32_t _decoder_id;
 
@@ -59,7 +65,8 @@ protected:
 	info::Stream _stream_info;
 
 	bool _kill_flag = false;
-	std::thread _codec_thread;
+	// CodecThread() is run by the decoder thread pool whenever a packet is enqueued
+	std::shared_ptr<TranscoderThreadPool::Job> _job;
 
 	CompleteHandler _complete_handler;
 };
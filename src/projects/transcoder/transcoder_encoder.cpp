@@ -258,6 +258,11 @@ std::shared_ptr<MediaTrack> &TranscodeEncoder::GetRefTrack()
 void TranscodeEncoder::SendBuffer(std::shared_ptr<const MediaFrame> frame)
 {
 	_input_buffer.Enqueue(std::move(frame));
+
+	if (_job != nullptr)
+	{
+		_job->Schedule();
+	}
 }
 
 void TranscodeEncoder::SendOutputBuffer(std::shared_ptr<MediaPacket> packet)
@@ -274,9 +279,21 @@ void TranscodeEncoder::Stop()
 
 	_input_buffer.Stop();
 
-	if (_codec_thread.joinable())
+	if (_job != nullptr)
 	{
-		_codec_thread.join();
-		logtd(ov::String::FormatString("encoder %s thread has ended", avcodec_get_name(GetCodecID())).CStr());
+		// Waits until the running CodecThread() returns
+		_job->Cancel();
+
+		logtd("encoder %s job has been cancelled", avcodec_get_name(GetCodecID()));
 	}
 }
+
+void TranscodeEncoder::StartJob(bool pinned)
+{
+	_job = TranscoderThreadPool::GetInstance(TranscoderThreadPool::Stage::Encoder)->CreateJob(_stream_info.GetId(), pinned, [this]() {
+		CodecThread();
+	});
+
+	// Processes the frames that are enqueued before the job is registered
+	_job->Schedule();
+}
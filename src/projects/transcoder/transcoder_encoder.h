@@ -10,6 +10,7 @@
 
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
+#include "transcoder_thread_pool.h"
 
 class TranscodeEncoder : public TranscodeBase<MediaFrame, MediaPacket>
 {
@@ -38,6 +39,11 @@ public:
 
 	cmn::Timebase GetTimebase() const;
 
+protected:
+	// Registers CodecThread() to the encoder thread pool
+	// A pinned job is always run by the same thread (for the codecs whose context must be used in the same thread)
+	void StartJob(bool pinned = false);
+
 
 public:
 
@@ -66,7 +72,8 @@ protected:
 	info::Stream _stream_info;
 
 	bool _kill_flag = false;
-	std::thread _codec_thread;
+	// CodecThread() is run by the encoder thread pool whenever a frame is enqueued
+	std::shared_ptr<TranscoderThreadPool::Job> _job;
 
 	CompleteHandler _complete_handler;
 
@@ -1,5 +1,6 @@
 #include "transcoder_filter.h"
 
+#include "filter/filter_multi_rescaler.h"
 #include "filter/filter_resampler.h"
 #include "filter/filter_rescaler.h"
 #include "transcoder_gpu.h"
@@ -37,6 +38,34 @@ bool TranscodeFilter::Configure(int32_t id,
 	return Create();
 }
 
+bool TranscodeFilter::ConfigureMultiOutput(const std::vector<int32_t> &filter_ids,
+										   const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+										   const std::vector<std::shared_ptr<MediaTrack>> &output_tracks,
+										   bool cascade,
+										   CompleteHandler complete_handler)
+{
+	if ((filter_ids.empty()) || (filter_ids.size() != output_tracks.size()) || (input_track->GetMediaType() != MediaType::Video))
+	{
+		logte("Invalid parameters for the multi-output rescaler");
+		return false;
+	}
+
+	logtd("Create a multi-output transcode filter. Track(%d -> %zu tracks)", input_track->GetId(), output_tracks.size());
+
+	_id = filter_ids.front();
+	_input_stream_info = input_stream_info;
+	_input_track = input_track;
+	_output_track = output_tracks.front();
+	_output_ids = filter_ids;
+	_output_tracks = output_tracks;
+	_cascade = cascade;
+	_complete_handler = complete_handler;
+
+	_timestamp_jump_threshold = (int64_t)_input_track->GetTimeBase().GetTimescale() * PTS_INCREMENT_LIMIT;
+
+	return Create();
+}
+
 bool TranscodeFilter::Create()
 {
 	std::lock_guard<std::shared_mutex> lock(_mutex);
@@ -55,7 +84,14 @@ bool TranscodeFilter::Create()
 			_internal = std::make_shared<FilterResampler>();
 			break;
 		case MediaType::Video:
-			_internal = std::make_shared<FilterRescaler>();
+			if (_output_tracks.empty() == false)
+			{
+				_internal = std::make_shared<FilterMultiRescaler>(_cascade);
+			}
+			else
+			{
+				_internal = std::make_shared<FilterRescaler>();
+			}
 			break;
 		default:
 			logte("Unsupported media type in filter");
@@ -69,9 +105,19 @@ bool TranscodeFilter::Create()
 		"trs",
 		name.LowerCaseString());
 	_internal->SetQueueUrn(urn);
-	_internal->SetCompleteHandler(bind(&TranscodeFilter::OnComplete, this, std::placeholders::_1));
+	_internal->SetStreamId(_input_stream_info->GetId());
+	_internal->SetCompleteHandler(bind(&TranscodeFilter::OnComplete, this, std::placeholders::_1, std::placeholders::_2));
+
+	bool success = false;
+	if (_output_tracks.empty() == false)
+	{
+		success = std::static_pointer_cast<FilterMultiRescaler>(_internal)->Configure(_input_track, _output_tracks);
+	}
+	else
+	{
+		success = _internal->Configure(_input_track, _output_track);
+	}
 
-	bool success = _internal->Configure(_input_track, _output_track);
 	if (success == false)
 	{
 		logte("Could not create filter");
@@ -170,11 +216,13 @@ void TranscodeFilter::SetCompleteHandler(CompleteHandler complete_handler)
 	_complete_handler = move(complete_handler);
 }
 
-void TranscodeFilter::OnComplete(std::shared_ptr<MediaFrame> frame)
+void TranscodeFilter::OnComplete(int32_t output_index, std::shared_ptr<MediaFrame> frame)
 {
 	if (_complete_handler)
 	{
-		_complete_handler(_id, frame);
+		auto id = (_output_ids.empty() == false) ? _output_ids[output_index] : _id;
+
+		_complete_handler(id, frame);
 	}
 }
 
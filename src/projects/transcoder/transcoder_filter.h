@@ -32,6 +32,14 @@ public:
 		const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
 		const std::shared_ptr<info::Stream> &output_stream_info, std::shared_ptr<MediaTrack> output_track,
 		CompleteHandler complete_handler);
+	// Rescales the input video track to all the output tracks with one filter graph
+	// The frames of output_tracks[n] are passed to the complete handler with filter_ids[n]
+	bool ConfigureMultiOutput(
+		const std::vector<int32_t> &filter_ids,
+		const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+		const std::vector<std::shared_ptr<MediaTrack>> &output_tracks,
+		bool cascade,
+		CompleteHandler complete_handler);
 	bool SendBuffer(std::shared_ptr<MediaFrame> buffer);
 	void Stop(); 
 
@@ -41,7 +49,7 @@ public:
 	std::shared_ptr<MediaTrack> &GetOutputTrack(); 
 
 	void SetCompleteHandler(CompleteHandler complete_handler);
-	void OnComplete(std::shared_ptr<MediaFrame> frame);
+	void OnComplete(int32_t output_index, std::shared_ptr<MediaFrame> frame);
 
 private:
 	bool Create();
@@ -57,6 +65,11 @@ private:
 	std::shared_ptr<info::Stream> _output_stream_info;
 	std::shared_ptr<MediaTrack> _output_track;
 
+	// Used by the multi-output rescaler
+	std::vector<int32_t> _output_ids;
+	std::vector<std::shared_ptr<MediaTrack>> _output_tracks;
+	bool _cascade = false;
+
 	CompleteHandler _complete_handler;
 
 	std::shared_mutex _mutex;
@@ -149,6 +149,8 @@ bool TranscoderStream::Update(const std::shared_ptr<info::Stream> &stream)
 	{
 		logti("%s This stream will be a smooth transition", _log_prefix.CStr());
 
+		UpdateAutoBypass(stream);
+
 		RemoveDecoders();
 
 		CreateDecoders();
@@ -161,6 +163,8 @@ bool TranscoderStream::Update(const std::shared_ptr<info::Stream> &stream)
 
 		RemoveAllComponents();
 
+		UpdateAutoBypass(stream);
+
 		CreateDecoders();
 
 		UpdateMsidOfOutputStreams(stream->GetMsid());
@@ -172,6 +176,20 @@ bool TranscoderStream::Update(const std::shared_ptr<info::Stream> &stream)
 }
 
 
+// The auto bypassed input tracks have no decoder, so a change of their format is not found by ChangeOutputFormat().
+// Check them with the updated input stream, so the decoder is created for the track that needs to be transcoded now.
+void TranscoderStream::UpdateAutoBypass(const std::shared_ptr<info::Stream> &stream)
+{
+	std::lock_guard<std::shared_mutex> lock(_format_change_mutex);
+
+	for (auto &[track_id, track] : stream->GetTracks())
+	{
+		UNUSED_VARIABLE(track_id)
+
+		UpdateAutoBypass(track);
+	}
+}
+
 void TranscoderStream::RemoveAllComponents()
 {
 	// Stop all decoder
@@ -485,21 +503,20 @@ int32_t TranscoderStream::BuildComposite()
 {
 	int32_t created_count = 0;
 
+	auto auto_bypass = _application_info.GetConfig().GetOutputProfiles().IsAutoBypass();
 
 	for (auto &[key, composite] : _composite_map)
 	{
 		UNUSED_VARIABLE(key)
 
-		for (auto &[output_stream, output_track] : composite->GetOutputTracks())
+		if (auto_bypass == true)
 		{
-			auto input_track = composite->GetInputTrack();
-
-			auto input_track_id = input_track->GetId();
-			auto decoder_id = input_track->GetId();
-
-			auto filter_id = composite->GetId();
-			auto encoder_id = composite->GetId();
+			ApplyAutoBypass(composite);
+		}
 
+		for (auto &[output_stream, output_track] : composite->GetOutputTracks())
+		{
+			auto input_track_id = composite->GetInputTrack()->GetId();
 			auto output_track_id = output_track->GetId();
 
 			// Bypass Flow: InputTrack -> OutputTrack
@@ -510,20 +527,7 @@ int32_t TranscoderStream::BuildComposite()
 			// Transcoding Flow: InputTrack -> Decoder -> Filter -> Encoder -> OutputTrack
 			else
 			{
-				// Decoding: InputTrack(1) -> Decoder(1)
-				_link_input_to_decoder[input_track_id] = decoder_id;
-
-				// Rescale/Resample Filtering: Decoder(1) -> Filter (N)
-				if (std::find(_link_decoder_to_filters[decoder_id].begin(), _link_decoder_to_filters[decoder_id].end(), filter_id) == _link_decoder_to_filters[decoder_id].end())
-				{
-					_link_decoder_to_filters[decoder_id].push_back(filter_id);
-				}
-
-				// Encoding: Filter(1) -> Encoder (1)
-				_link_filter_to_encoder[filter_id] = encoder_id;
-
-				// Flushing: Encoder(1) -> OutputTrack (N)
-				_link_encoder_to_outputs[encoder_id].push_back(make_pair(output_stream, output_track_id));
+				LinkTranscodingFlow(composite, output_stream, output_track);
 			}
 		}
 
@@ -535,6 +539,185 @@ int32_t TranscoderStream::BuildComposite()
 	return created_count;
 }
 
+void TranscoderStream::LinkTranscodingFlow(const std::shared_ptr<CompositeContext> &composite, const std::shared_ptr<info::Stream> &output_stream, const std::shared_ptr<MediaTrack> &output_track)
+{
+	auto input_track_id = composite->GetInputTrack()->GetId();
+	auto decoder_id = composite->GetInputTrack()->GetId();
+
+	auto filter_id = composite->GetId();
+	auto encoder_id = composite->GetId();
+
+	// Decoding: InputTrack(1) -> Decoder(1)
+	_link_input_to_decoder[input_track_id] = decoder_id;
+
+	// Rescale/Resample Filtering: Decoder(1) -> Filter (N)
+	if (std::find(_link_decoder_to_filters[decoder_id].begin(), _link_decoder_to_filters[decoder_id].end(), filter_id) == _link_decoder_to_filters[decoder_id].end())
+	{
+		_link_decoder_to_filters[decoder_id].push_back(filter_id);
+	}
+
+	// Encoding: Filter(1) -> Encoder (1)
+	_link_filter_to_encoder[filter_id] = encoder_id;
+
+	// Flushing: Encoder(1) -> OutputTrack (N)
+	_link_encoder_to_outputs[encoder_id].push_back(make_pair(output_stream, output_track->GetId()));
+}
+
+bool TranscoderStream::ApplyAutoBypass(const std::shared_ptr<CompositeContext> &composite)
+{
+	auto &input_track = composite->GetInputTrack();
+	auto &output_tracks = composite->GetOutputTracks();
+
+	// The output tracks of a composite are made from the same profile, so they share one encoder.
+	// Pass through them only if all of them match the input track.
+	if (output_tracks.empty() == true)
+	{
+		return false;
+	}
+
+	for (auto &[output_stream, output_track] : output_tracks)
+	{
+		UNUSED_VARIABLE(output_stream)
+
+		if (IsMatchesAutoBypassCondition(input_track, output_track) == false)
+		{
+			return false;
+		}
+	}
+
+	for (auto &[output_stream, output_track] : output_tracks)
+	{
+		// Keep the settings of the profile to transcode again when the input track is changed
+		_auto_bypass_origin_tracks[output_track->GetId()] = output_track->Clone();
+
+		output_track->SetBypass(true);
+		output_track->SetCodecLibraryId(input_track->GetCodecLibraryId());
+		output_track->SetTimeBase(input_track->GetTimeBase());
+
+		if (output_track->GetMediaType() == cmn::MediaType::Video)
+		{
+			output_track->SetWidth(input_track->GetWidth());
+			output_track->SetHeight(input_track->GetHeight());
+		}
+		else if (output_track->GetMediaType() == cmn::MediaType::Audio)
+		{
+			output_track->SetChannel(input_track->GetChannel());
+			output_track->GetSample().SetFormat(input_track->GetSample().GetFormat());
+			output_track->SetSampleRate(input_track->GetSampleRate());
+		}
+
+		logti("%s The output track matches the input track and will be passed through. InputTrack(%d) > StreamName(%s) > OutputTrack(%d)",
+			  _log_prefix.CStr(), input_track->GetId(), output_stream->GetName().CStr(), output_track->GetId());
+	}
+
+	return true;
+}
+
+void TranscoderStream::UpdateAutoBypass(MediaFrame *buffer)
+{
+	auto input_track = _input_stream->GetTrack(buffer->GetTrackId());
+	if (input_track == nullptr)
+	{
+		return;
+	}
+
+	UpdateAutoBypass(input_track);
+}
+
+void TranscoderStream::UpdateAutoBypass(const std::shared_ptr<MediaTrack> &input_track)
+{
+	if (_auto_bypass_origin_tracks.empty() == true)
+	{
+		return;
+	}
+
+	MediaTrackId input_track_id = input_track->GetId();
+
+	bool is_changed = false;
+
+	for (auto &[key, composite] : _composite_map)
+	{
+		UNUSED_VARIABLE(key)
+
+		if (input_track_id != composite->GetInputTrack()->GetId())
+		{
+			continue;
+		}
+
+		auto &output_tracks = composite->GetOutputTracks();
+
+		bool need_transcoding = false;
+		for (auto &[output_stream, output_track] : output_tracks)
+		{
+			UNUSED_VARIABLE(output_stream)
+
+			auto origin_track_it = _auto_bypass_origin_tracks.find(output_track->GetId());
+			if ((origin_track_it != _auto_bypass_origin_tracks.end()) &&
+				(IsMatchesAutoBypassCondition(input_track, origin_track_it->second) == false))
+			{
+				need_transcoding = true;
+				break;
+			}
+		}
+
+		if (need_transcoding == false)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::shared_mutex> link_lock(_link_mutex);
+
+		for (auto &[output_stream, output_track] : output_tracks)
+		{
+			auto origin_track_it = _auto_bypass_origin_tracks.find(output_track->GetId());
+			if (origin_track_it == _auto_bypass_origin_tracks.end())
+			{
+				continue;
+			}
+			auto origin_track = origin_track_it->second;
+
+			logti("%s The input track has been changed. The output track will be transcoded. InputTrack(%d) > StreamName(%s) > OutputTrack(%d)",
+				  _log_prefix.CStr(), input_track_id, output_stream->GetName().CStr(), output_track->GetId());
+
+			// The timebase is kept because the output track has already been delivered to the publishers
+			output_track->SetBypass(false);
+			output_track->SetCodecLibraryId(origin_track->GetCodecLibraryId());
+
+			if (output_track->GetMediaType() == cmn::MediaType::Video)
+			{
+				output_track->SetWidth(origin_track->GetWidth());
+				output_track->SetHeight(origin_track->GetHeight());
+			}
+			else if (output_track->GetMediaType() == cmn::MediaType::Audio)
+			{
+				output_track->SetChannel(origin_track->GetChannel());
+
+				if (origin_track->GetSampleRate() != 0)
+				{
+					output_track->SetSampleRate(origin_track->GetSampleRate());
+				}
+			}
+
+			auto &bypass_outputs = _link_input_to_outputs[input_track_id];
+			bypass_outputs.erase(std::remove_if(bypass_outputs.begin(), bypass_outputs.end(), [&](const auto &output) -> bool {
+									 return output.second == output_track->GetId();
+								 }),
+								 bypass_outputs.end());
+
+			LinkTranscodingFlow(composite, output_stream, output_track);
+
+			_auto_bypass_origin_tracks.erase(origin_track_it);
+		}
+
+		is_changed = true;
+	}
+
+	if (is_changed == true)
+	{
+		logtd("%s", GetInfoStringComposite().CStr());
+	}
+}
+
 // LOG for DEBUG
 ov::String TranscoderStream::GetInfoStringComposite()
 {
@@ -778,27 +961,67 @@ int32_t TranscoderStream::CreateFilters(MediaFrame *buffer)
 	// 1. Get Input Track of Decoder
 	auto input_track = _decoders[decoder_id]->GetRefTrack();
 
-	auto decoder_to_filters_it = _link_decoder_to_filters.find(decoder_id);
-	if (decoder_to_filters_it == _link_decoder_to_filters.end())
+	// The links can be changed by UpdateAutoBypass() of another track, so copy them
+	std::vector<std::pair<int32_t, MediaTrackId>> filter_to_encoder_ids;
 	{
-		logtw("%s Could not found filter list related to decoder", _log_prefix.CStr());
-		return created_count;
+		std::shared_lock<std::shared_mutex> link_lock(_link_mutex);
+
+		auto decoder_to_filters_it = _link_decoder_to_filters.find(decoder_id);
+		if (decoder_to_filters_it == _link_decoder_to_filters.end())
+		{
+			logtw("%s Could not found filter list related to decoder", _log_prefix.CStr());
+			return created_count;
+		}
+
+		for (auto &filter_id : decoder_to_filters_it->second)
+		{
+			auto filter_to_encoder_it = _link_filter_to_encoder.find(filter_id);
+			if (filter_to_encoder_it == _link_filter_to_encoder.end())
+			{
+				logte("%s Could not found encoder related to filter, Filter(%d)", _log_prefix.CStr(), filter_id);
+				continue;
+			}
+
+			filter_to_encoder_ids.emplace_back(filter_id, filter_to_encoder_it->second);
+		}
 	}
-	auto filter_ids = decoder_to_filters_it->second;
 
 	// 2. Get Output Track of Encoders
-	for (auto &filter_id : filter_ids)
+	std::vector<int32_t> output_filter_ids;
+	std::vector<MediaTrackId> output_encoder_ids;
+	std::vector<std::shared_ptr<MediaTrack>> output_tracks;
+
+	for (auto &[filter_id, encoder_id] : filter_to_encoder_ids)
 	{
-		MediaTrackId encoder_id = _link_filter_to_encoder[filter_id];
 		if (_encoders.find(encoder_id) == _encoders.end())
 		{
 			logte("%s encoder is not allocated, Encoder(%d)", _log_prefix.CStr(), encoder_id);
 			continue;
 		}
 
-		auto output_track = _encoders[encoder_id]->GetRefTrack();
+		output_filter_ids.push_back(filter_id);
+		output_encoder_ids.push_back(encoder_id);
+		output_tracks.push_back(_encoders[encoder_id]->GetRefTrack());
+	}
 
-		logtd("%s Create Filter. Decoder(%d) > Filter(%d) > Encoder(%d)", _log_prefix.CStr(), decoder_id, filter_id, encoder_id);
+	// 3. Rescale to all renditions with one filter if possible
+	if (IsMultiOutputFilterAvailable(input_track, output_tracks) == true)
+	{
+		logtd("%s Create Multi-output Filter. Decoder(%d) > Filter(%d ~ %zu filters)", _log_prefix.CStr(), decoder_id, output_filter_ids.front(), output_filter_ids.size());
+		if (CreateMultiOutputFilter(output_filter_ids, input_track, output_tracks) == true)
+		{
+			return output_filter_ids.size();
+		}
+
+		logtw("%s Failed to create multi-output filter. Create a filter for each rendition", _log_prefix.CStr());
+	}
+
+	for (size_t index = 0; index < output_filter_ids.size(); index++)
+	{
+		auto filter_id = output_filter_ids[index];
+		auto &output_track = output_tracks[index];
+
+		logtd("%s Create Filter. Decoder(%d) > Filter(%d) > Encoder(%d)", _log_prefix.CStr(), decoder_id, filter_id, output_encoder_ids[index]);
 		if(CreateFilter(filter_id, input_track, output_track) == false)
 		{
 			continue;
@@ -810,6 +1033,68 @@ int32_t TranscoderStream::CreateFilters(MediaFrame *buffer)
 	return created_count;
 }
 
+bool TranscoderStream::IsMultiOutputFilterAvailable(const std::shared_ptr<MediaTrack> &input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks)
+{
+	auto &transcoder_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetTranscoder();
+
+	if ((transcoder_config.IsMultiOutputRescalerEnabled() == false) ||
+		(input_track->GetMediaType() != cmn::MediaType::Video) ||
+		(output_tracks.size() < 2))
+	{
+		return false;
+	}
+
+	// Hardware scalers (scale_cuda, multiscale_xma) keep using a filter per rendition
+	switch (input_track->GetCodecLibraryId())
+	{
+		case cmn::MediaCodecLibraryId::NVENC:
+		case cmn::MediaCodecLibraryId::XMA:
+			return false;
+		default:
+			break;
+	}
+
+	return true;
+}
+
+bool TranscoderStream::CreateMultiOutputFilter(const std::vector<int32_t> &filter_ids, std::shared_ptr<MediaTrack> input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks)
+{
+	std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+	// remove the previous created filters
+	for (auto &filter_id : filter_ids)
+	{
+		auto filter_it = _filters.find(filter_id);
+		if (filter_it != _filters.end())
+		{
+			filter_it->second->Stop();
+			_filters.erase(filter_it);
+		}
+	}
+
+	auto input_stream = GetInputStream();
+	if(input_stream == nullptr)
+	{
+		logte("%s Could not found input stream", _log_prefix.CStr());
+		return false;
+	}
+
+	auto &transcoder_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetTranscoder();
+
+	auto filter = std::make_shared<TranscodeFilter>();
+
+	if (filter->ConfigureMultiOutput(filter_ids, input_stream, input_track, output_tracks, transcoder_config.IsCascadeRescalerEnabled(), bind(&TranscoderStream::OnFilteredFrame, this, std::placeholders::_1, std::placeholders::_2)) != true)
+	{
+		logte("%s Failed to create multi-output filter. Filter(%d)", _log_prefix.CStr(), filter_ids.front());
+		return false;
+	}
+
+	// The decoded frames are sent to the first filter id only, and the filtered frames are sent to the encoder of each filter id
+	_filters[filter_ids.front()] = filter;
+
+	return true;
+}
+
 bool TranscoderStream::CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track)
 {
 	std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
@@ -865,6 +1150,9 @@ void TranscoderStream::ChangeOutputFormat(MediaFrame *buffer)
 	// Update Track of Input Stream
 	UpdateInputTrack(buffer);
 
+	// Transcode the auto bypassed tracks if they no longer match the input track
+	UpdateAutoBypass(buffer);
+
 	// Update Track of Output Stream
 	UpdateOutputTrack(buffer);
 
@@ -1020,6 +1308,8 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 {
 	MediaTrackId input_track_id = packet->GetTrackId();
 
+	std::shared_lock<std::shared_mutex> link_lock(_link_mutex);
+
 	// 1. bypass track processing.
 	auto output_streams_it = _link_input_to_outputs.find(input_track_id);
 	if (output_streams_it != _link_input_to_outputs.end())
@@ -1063,6 +1353,8 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 	}
 	auto decoder_id = input_to_decoder_it->second;
 
+	link_lock.unlock();
+
 	std::shared_lock<std::shared_mutex> lock(_decoder_map_mutex);
 
 	auto decoder_it = _decoders.find(decoder_id);
@@ -1071,6 +1363,12 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 		return;
 	}
 	auto decoder = decoder_it->second;
+
+	if (packet->GetTrace() != nullptr)
+	{
+		_decoder_traces.Push(decoder_id, packet->GetPts(), packet->GetTrace());
+	}
+
 	decoder->SendBuffer(std::move(packet));
 }
 
@@ -1204,6 +1502,13 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, int32_t decoder_id
 
 			auto input_track = GetInputTrack(decoder_id);
 
+			auto trace = _decoder_traces.Pop(decoder_id, decoded_frame->GetPts());
+			if (trace != nullptr)
+			{
+				trace->Mark(MediaTrace::Point::Decoded);
+				decoded_frame->SetTrace(trace);
+			}
+
 			// Record the timestamp of the last decoded frame. managed by microseconds.
 			_last_decoded_frame_pts[decoder_id] = decoded_frame->GetPts() * input_track->GetTimeBase().GetExpr() * 1000000;
 
@@ -1240,21 +1545,22 @@ std::shared_ptr<MediaFrame> TranscoderStream::GetLastDecodedFrame(int32_t decode
 
 std::shared_ptr<MediaTrack> TranscoderStream::GetInputTrackOfFilter(int32_t decoder_id)
 {
-	auto decoder_to_filter_map_it = _link_decoder_to_filters.find(decoder_id);
-	if (decoder_to_filter_map_it == _link_decoder_to_filters.end())
+	int32_t filter_id;
 	{
-		return nullptr;
-	}
+		std::shared_lock<std::shared_mutex> link_lock(_link_mutex);
 
-	auto filter_ids = decoder_to_filter_map_it->second;
-	if (filter_ids.size() == 0)
-	{
-		return nullptr;
+		auto decoder_to_filter_map_it = _link_decoder_to_filters.find(decoder_id);
+		if ((decoder_to_filter_map_it == _link_decoder_to_filters.end()) || decoder_to_filter_map_it->second.empty())
+		{
+			return nullptr;
+		}
+
+		filter_id = decoder_to_filter_map_it->second[0];
 	}
 
 	std::shared_lock<std::shared_mutex> lock(_filter_map_mutex);
 
-	auto it = _filters.find(filter_ids[0]);
+	auto it = _filters.find(filter_id);
 	if (it == _filters.end())
 	{
 		return nullptr;
@@ -1288,6 +1594,11 @@ void TranscoderStream::OnFilteredFrame(int32_t filter_id, std::shared_ptr<MediaF
 {
 	filtered_frame->SetTrackId(filter_id);
 
+	if (_filter_traces.IsEmpty() == false)
+	{
+		PopFilterTrace(filter_id, filtered_frame);
+	}
+
 	EncodeFrame(std::move(filtered_frame));
 }
 
@@ -1295,6 +1606,8 @@ TranscodeResult TranscoderStream::EncodeFrame(std::shared_ptr<const MediaFrame>
 {
 	auto filter_id = frame->GetTrackId();
 
+	std::shared_lock<std::shared_mutex> link_lock(_link_mutex);
+
 	auto filter_to_encoder_it = _link_filter_to_encoder.find(filter_id);
 	if(filter_to_encoder_it == _link_filter_to_encoder.end())
 	{
@@ -1302,6 +1615,8 @@ TranscodeResult TranscoderStream::EncodeFrame(std::shared_ptr<const MediaFrame>
 	}
 	auto encoder_id = filter_to_encoder_it->second;
 
+	link_lock.unlock();
+
 	std::shared_lock<std::shared_mutex> lock(_encoder_map_mutex);
 	
 	auto encoder_map_it = _encoders.find(encoder_id);
@@ -1311,6 +1626,11 @@ TranscodeResult TranscoderStream::EncodeFrame(std::shared_ptr<const MediaFrame>
 	}
 	auto encoder = encoder_map_it->second.get();
 
+	if (frame->GetTrace() != nullptr)
+	{
+		_encoder_traces.Push(encoder_id, frame->GetPts(), frame->GetTrace());
+	}
+
 	encoder->SendBuffer(std::move(frame));
 
 	return TranscodeResult::NoData;
@@ -1325,6 +1645,8 @@ void TranscoderStream::OnEncodedPacket(int32_t encoder_id, std::shared_ptr<Media
 	}
 
 	// Explore if output tracks exist to send encoded packets
+	std::shared_lock<std::shared_mutex> link_lock(_link_mutex);
+
 	auto encoder_to_outputs_it = _link_encoder_to_outputs.find(encoder_id);
 	if (encoder_to_outputs_it == _link_encoder_to_outputs.end())
 	{
@@ -1332,6 +1654,16 @@ void TranscoderStream::OnEncodedPacket(int32_t encoder_id, std::shared_ptr<Media
 	}
 	auto output_tracks = encoder_to_outputs_it->second;
 
+	link_lock.unlock();
+
+	auto trace = _encoder_traces.Pop(encoder_id, encoded_packet->GetPts());
+	if (trace != nullptr)
+	{
+		trace->Mark(MediaTrace::Point::Encoded);
+		// ClonePacket() gives each output its own trace
+		encoded_packet->SetTrace(trace);
+	}
+
 	// If a track exists to output, copy the encoded packet and send it to that track.
 	for (auto &[output_stream, output_track_id] : output_tracks)
 	{
@@ -1411,6 +1743,8 @@ void TranscoderStream::SendFrame(std::shared_ptr<info::Stream> &stream, std::sha
 
 void TranscoderStream::SpreadToFilters(int32_t decoder_id, std::shared_ptr<MediaFrame> frame)
 {
+	std::shared_lock<std::shared_mutex> link_lock(_link_mutex);
+
 	auto filters = _link_decoder_to_filters.find(decoder_id);
 	if (filters == _link_decoder_to_filters.end())
 	{
@@ -1420,8 +1754,19 @@ void TranscoderStream::SpreadToFilters(int32_t decoder_id, std::shared_ptr<Media
 	}
 	auto filter_ids = filters->second;
 
+	link_lock.unlock();
+
 	for (auto &filter_id : filter_ids)
 	{
+		{
+			// The filter ids merged into a multi-output filter have no filter
+			std::shared_lock<std::shared_mutex> lock(_filter_map_mutex);
+			if (_filters.find(filter_id) == _filters.end())
+			{
+				continue;
+			}
+		}
+
 		auto frame_clone = frame->CloneFrame();
 		if (frame_clone == nullptr)
 		{
@@ -1430,6 +1775,51 @@ void TranscoderStream::SpreadToFilters(int32_t decoder_id, std::shared_ptr<Media
 			continue;
 		}
 
+		if (frame->GetTrace() != nullptr)
+		{
+			auto input_track = GetInputTrack(decoder_id);
+			if (input_track != nullptr)
+			{
+				int64_t pts_us = (int64_t)((double)frame->GetPts() * input_track->GetTimeBase().GetExpr() * 1000000);
+				_filter_traces.Push(filter_id, pts_us, frame->GetTrace()->Clone());
+			}
+		}
+
 		FilterFrame(filter_id, std::move(frame_clone));
 	}
 }
+
+void TranscoderStream::PopFilterTrace(int32_t filter_id, const std::shared_ptr<MediaFrame> &filtered_frame)
+{
+	// The filtered frame has the timebase of the output track
+	std::shared_ptr<MediaTrack> output_track;
+	{
+		std::shared_lock<std::shared_mutex> link_lock(_link_mutex);
+
+		auto filter_to_encoder_it = _link_filter_to_encoder.find(filter_id);
+		if (filter_to_encoder_it == _link_filter_to_encoder.end())
+		{
+			return;
+		}
+
+		std::shared_lock<std::shared_mutex> lock(_encoder_map_mutex);
+
+		auto encoder_it = _encoders.find(filter_to_encoder_it->second);
+		if (encoder_it == _encoders.end())
+		{
+			return;
+		}
+
+		output_track = encoder_it->second->GetRefTrack();
+	}
+
+	int64_t pts_us = (int64_t)((double)filtered_frame->GetPts() * output_track->GetTimeBase().GetExpr() * 1000000);
+
+	// The filter may round the timestamp while rescaling the timebase
+	auto trace = _filter_traces.Pop(filter_id, pts_us, MEDIA_TRACE_PTS_TOLERANCE_US);
+	if (trace != nullptr)
+	{
+		trace->Mark(MediaTrace::Point::Filtered);
+		filtered_frame->SetTrace(trace);
+	}
+}
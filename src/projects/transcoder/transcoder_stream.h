@@ -100,6 +100,8 @@ private:
 	std::shared_mutex _decoder_map_mutex;
 	std::shared_mutex _filter_map_mutex;
 	std::shared_mutex _encoder_map_mutex;
+	// Protects the links that can be changed while the stream is running (by <AutoBypass>)
+	std::shared_mutex _link_mutex;
 
 	bool _is_stopped = true;
 
@@ -140,6 +142,18 @@ private:
 	// [ENCODER_ID, OUTPUT_TRACKS]
 	std::map<MediaTrackId, std::vector<std::pair<std::shared_ptr<info::Stream>, MediaTrackId>>> _link_encoder_to_outputs;
 
+	// Output tracks that are passed through by <AutoBypass>, and their settings before bypass
+	// [OUTPUT_TRACK_ID, OUTPUT_TRACK]
+	std::map<MediaTrackId, std::shared_ptr<MediaTrack>> _auto_bypass_origin_tracks;
+
+	// Traces of the sampled packets waiting for the output of each component (see MediaTrace)
+	// Decoder: keyed by PTS in the timebase of the input track
+	MediaTraceMap _decoder_traces;
+	// Filter: keyed by PTS in microseconds, because the filter changes the timebase
+	MediaTraceMap _filter_traces;
+	// Encoder: keyed by PTS in the timebase of the output track
+	MediaTraceMap _encoder_traces;
+
 	// Decoder Component
 	// DECODER_ID, DECODER
 	std::map<MediaTrackId, std::shared_ptr<TranscodeDecoder>> _decoders;
@@ -176,6 +190,15 @@ private:
 						 std::shared_ptr<info::Stream> output_stream,
 						 std::shared_ptr<MediaTrack> output_track);
 
+	void LinkTranscodingFlow(const std::shared_ptr<CompositeContext> &composite, const std::shared_ptr<info::Stream> &output_stream, const std::shared_ptr<MediaTrack> &output_track);
+
+	// Pass through the output tracks that match the input track without decoding and encoding
+	bool ApplyAutoBypass(const std::shared_ptr<CompositeContext> &composite);
+	// Transcode the auto bypassed output tracks again if the input track no longer matches them
+	void UpdateAutoBypass(MediaFrame *buffer);
+	void UpdateAutoBypass(const std::shared_ptr<MediaTrack> &input_track);
+	void UpdateAutoBypass(const std::shared_ptr<info::Stream> &stream);
+
 	ov::String GetInfoStringComposite();
 
 	int32_t CreateDecoders();
@@ -183,6 +206,8 @@ private:
 
 	int32_t CreateFilters(MediaFrame *buffer);
 	bool CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track);
+	bool IsMultiOutputFilterAvailable(const std::shared_ptr<MediaTrack> &input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks);
+	bool CreateMultiOutputFilter(const std::vector<int32_t> &filter_ids, std::shared_ptr<MediaTrack> input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks);
 	std::shared_ptr<MediaTrack> GetInputTrackOfFilter(int32_t decoder_id);
 
 	int32_t CreateEncoders(MediaFrame *buffer);
@@ -203,6 +228,7 @@ private:
 
 	// Step 2: Filter (resample/rescale the decoded frame)
 	void SpreadToFilters(int32_t decoder_id, std::shared_ptr<MediaFrame> frame);
+	void PopFilterTrace(int32_t filter_id, const std::shared_ptr<MediaFrame> &filtered_frame);
 	TranscodeResult FilterFrame(int32_t track_id, std::shared_ptr<MediaFrame> frame);
 	void OnFilteredFrame(int32_t filter_id, std::shared_ptr<MediaFrame> decoded_frame);
 	bool IsAvailableSmoothTransitionStream(const std::shared_ptr<info::Stream> &stream);
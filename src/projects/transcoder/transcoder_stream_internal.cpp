@@ -549,3 +549,69 @@ bool TranscoderStreamInternal::IsMatchesBypassCondition(const std::shared_ptr<Me
 
 	return (if_count > 0) ? true : false;
 }
+
+bool TranscoderStreamInternal::IsMatchesAutoBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track)
+{
+	if ((output_track->IsBypass() == true) || (input_track->GetMediaType() != output_track->GetMediaType()))
+	{
+		return false;
+	}
+
+	if (input_track->GetCodecId() != output_track->GetCodecId())
+	{
+		return false;
+	}
+
+	// If the bitrate is set, the input track must not exceed it
+	if ((output_track->GetBitrateByConfig() > 0) &&
+		((input_track->GetBitrate() <= 0) || (input_track->GetBitrate() > output_track->GetBitrateByConfig())))
+	{
+		return false;
+	}
+
+	switch (output_track->GetMediaType())
+	{
+		case cmn::MediaType::Video: {
+			// The resolution of the input track must be known to compare
+			if ((output_track->GetWidth() != 0) && (input_track->GetWidth() != output_track->GetWidth()))
+			{
+				return false;
+			}
+
+			if ((output_track->GetHeight() != 0) && (input_track->GetHeight() != output_track->GetHeight()))
+			{
+				return false;
+			}
+
+			if ((output_track->GetFrameRateByConfig() != 0.0) && (input_track->GetFrameRate() != output_track->GetFrameRateByConfig()))
+			{
+				return false;
+			}
+
+			// The GOP structure and the profile of the input track cannot be guaranteed
+			if ((output_track->GetKeyFrameIntervalByConfig() != 0) || (output_track->GetBFrames() != 0) || (output_track->GetProfile().IsEmpty() == false))
+			{
+				return false;
+			}
+		}
+		break;
+
+		case cmn::MediaType::Audio: {
+			if ((output_track->GetSampleRate() != 0) && (input_track->GetSampleRate() != output_track->GetSampleRate()))
+			{
+				return false;
+			}
+
+			if (input_track->GetChannel().GetCounts() != output_track->GetChannel().GetCounts())
+			{
+				return false;
+			}
+		}
+		break;
+
+		default:
+			return false;
+	}
+
+	return true;
+}
@@ -42,5 +42,8 @@ public:
 	bool IsMatchesBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::VideoProfile &profile);
 	bool IsMatchesBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::AudioProfile &profile);
 
+	// Returns true if the output track can be made by passing through the input track (used by <AutoBypass>)
+	bool IsMatchesAutoBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track);
+
 
 };
@@ -0,0 +1,311 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_thread_pool.h"
+
+#include <config/config_manager.h>
+
+#include "transcoder_private.h"
+
+TranscoderThreadPool::Job::Job(TranscoderThreadPool *pool, size_t home_worker_index, bool pinned, std::function<void()> task)
+	: _pool(pool),
+	  _home_worker_index(home_worker_index),
+	  _pinned(pinned),
+	  _task(std::move(task))
+{
+}
+
+void TranscoderThreadPool::Job::Schedule()
+{
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		if (_cancelled || _scheduled)
+		{
+			// Already in the run queue
+			return;
+		}
+
+		_scheduled = true;
+
+		if (_running)
+		{
+			// The worker that is running the task will enqueue it again
+			return;
+		}
+	}
+
+	_pool->Enqueue(shared_from_this(), _home_worker_index);
+}
+
+void TranscoderThreadPool::Job::Cancel()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	_cancelled = true;
+
+	if (_running_thread_id == std::this_thread::get_id())
+	{
+		// Cancelled by the task itself
+		return;
+	}
+
+	_condition.wait(lock, [this]() -> bool { return _running == false; });
+}
+
+bool TranscoderThreadPool::Job::Run()
+{
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		if (_cancelled)
+		{
+			return false;
+		}
+
+		_scheduled = false;
+		_running = true;
+		_running_thread_id = std::this_thread::get_id();
+	}
+
+	_task();
+
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	_running = false;
+	_running_thread_id = std::thread::id();
+	_condition.notify_all();
+
+	// Schedule() was called while the task was running
+	return (_cancelled == false) && _scheduled;
+}
+
+TranscoderThreadPool *TranscoderThreadPool::GetInstance(Stage stage)
+{
+	// Intentionally leaked: the jobs may be cancelled while the process is terminating
+	static TranscoderThreadPool *decoder_pool = nullptr;
+	static TranscoderThreadPool *filter_pool = nullptr;
+	static TranscoderThreadPool *encoder_pool = nullptr;
+	static std::once_flag decoder_once, filter_once, encoder_once;
+
+	auto create_pool = [stage]() -> TranscoderThreadPool * {
+		auto &config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetTranscoder();
+		int worker_count = 0;
+
+		switch (stage)
+		{
+			case Stage::Decoder:
+				worker_count = config.GetDecoderThreadCount();
+				break;
+			case Stage::Filter:
+				worker_count = config.GetFilterThreadCount();
+				break;
+			case Stage::Encoder:
+				worker_count = config.GetEncoderThreadCount();
+				break;
+		}
+
+		if (worker_count <= 0)
+		{
+			worker_count = std::max(1U, std::thread::hardware_concurrency());
+		}
+
+		return new TranscoderThreadPool(stage, worker_count);
+	};
+
+	switch (stage)
+	{
+		case Stage::Decoder:
+			std::call_once(decoder_once, [&]() { decoder_pool = create_pool(); });
+			return decoder_pool;
+
+		case Stage::Filter:
+			std::call_once(filter_once, [&]() { filter_pool = create_pool(); });
+			return filter_pool;
+
+		case Stage::Encoder:
+			std::call_once(encoder_once, [&]() { encoder_pool = create_pool(); });
+			return encoder_pool;
+	}
+
+	return nullptr;
+}
+
+const char *TranscoderThreadPool::StringFromStage(Stage stage)
+{
+	switch (stage)
+	{
+		case Stage::Decoder:
+			return "decoder";
+		case Stage::Filter:
+			return "filter";
+		case Stage::Encoder:
+			return "encoder";
+	}
+
+	return "unknown";
+}
+
+TranscoderThreadPool::TranscoderThreadPool(Stage stage, size_t worker_count)
+	: _stage(stage),
+	  _idle(std::make_unique<std::atomic<bool>[]>(worker_count))
+{
+	for (size_t index = 0; index < worker_count; index++)
+	{
+		_idle[index] = false;
+
+		auto urn = std::make_shared<info::ManagedQueue::URN>(
+			info::VHostAppName::InvalidVHostAppName(),
+			nullptr,
+			"trs",
+			ov::String::FormatString("pool_%s_%zu", StringFromStage(stage), index));
+
+		_queues.push_back(std::make_shared<ov::ManagedQueue<std::shared_ptr<Job>>>(urn));
+	}
+
+	for (size_t index = 0; index < worker_count; index++)
+	{
+		_workers.emplace_back(&TranscoderThreadPool::WorkerThread, this, index);
+
+		auto name = ov::String::FormatString("Trs%c#%zu", ::toupper(StringFromStage(stage)[0]), index);
+		pthread_setname_np(_workers.back().native_handle(), name.CStr());
+	}
+
+	logti("The transcoder %s thread pool has been created with %zu threads", StringFromStage(stage), worker_count);
+}
+
+std::shared_ptr<TranscoderThreadPool::Job> TranscoderThreadPool::CreateJob(info::stream_id_t stream_id, bool pinned, std::function<void()> task)
+{
+	// The components of a stream have the same home worker
+	return std::shared_ptr<Job>(new Job(this, stream_id % _queues.size(), pinned, std::move(task)));
+}
+
+void TranscoderThreadPool::Enqueue(const std::shared_ptr<Job> &job, size_t worker_index)
+{
+	_queues[worker_index]->Enqueue(job);
+
+	// Pairs with the fence in WorkerThread(): either the idle worker finds the job, or the job finds the idle worker
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if ((job->IsPinned() == false) && (_idle[worker_index] == false))
+	{
+		// The home worker is busy
+		WakeIdleWorker(worker_index);
+	}
+}
+
+void TranscoderThreadPool::WakeIdleWorker(size_t worker_index)
+{
+	auto queue_count = _queues.size();
+
+	for (size_t offset = 1; offset < queue_count; offset++)
+	{
+		auto idle_index = (worker_index + offset) % queue_count;
+
+		// Only one steal request is sent to an idle worker
+		if (_idle[idle_index].exchange(false))
+		{
+			_queues[idle_index]->Enqueue(nullptr);
+			return;
+		}
+	}
+}
+
+std::shared_ptr<TranscoderThreadPool::Job> TranscoderThreadPool::Steal(size_t worker_index)
+{
+	auto queue_count = _queues.size();
+
+	for (size_t offset = 1; offset < queue_count; offset++)
+	{
+		auto victim_index = (worker_index + offset) % queue_count;
+		auto job = _queues[victim_index]->Dequeue(0);
+
+		if (job.has_value() == false)
+		{
+			continue;
+		}
+
+		if (job.value() == nullptr)
+		{
+			// A steal request to the victim. Give it back, so the victim is still woken up
+			_queues[victim_index]->Enqueue(nullptr);
+			continue;
+		}
+
+		if (job.value()->IsPinned() && (job.value()->_home_worker_index != worker_index))
+		{
+			// A pinned job must be run by the home worker. Return it, and stop stealing to avoid ping-pong
+			Enqueue(job.value(), job.value()->_home_worker_index);
+			return nullptr;
+		}
+
+		return job.value();
+	}
+
+	return nullptr;
+}
+
+void TranscoderThreadPool::WorkerThread(size_t worker_index)
+{
+	auto &queue = _queues[worker_index];
+
+	while (true)
+	{
+		std::shared_ptr<Job> job;
+
+		auto item = queue->Dequeue(0);
+
+		if (item.has_value())
+		{
+			job = std::move(item.value());
+
+			if (job == nullptr)
+			{
+				// A steal request that arrived while this worker was busy
+				continue;
+			}
+		}
+		else
+		{
+			_idle[worker_index] = true;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			job = Steal(worker_index);
+
+			if (job == nullptr)
+			{
+				// Sleep until a job is enqueued to this worker, or another worker requests to steal
+				item = queue->Dequeue();
+			}
+
+			_idle[worker_index] = false;
+
+			if (job == nullptr)
+			{
+				if (item.has_value() == false)
+				{
+					continue;
+				}
+
+				job = std::move(item.value());
+
+				if (job == nullptr)
+				{
+					// A steal request
+					continue;
+				}
+			}
+		}
+
+		if (job->Run())
+		{
+			// New inputs were enqueued while running
+			Enqueue(job, job->_home_worker_index);
+		}
+	}
+}
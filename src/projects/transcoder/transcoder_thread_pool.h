@@ -0,0 +1,106 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/stream.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/managed_queue/managed_queue.h>
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs the decoders, filters and encoders of all streams with a few threads per stage,
+// instead of a dedicated thread per component.
+//
+// A component is registered as a Job, and the Job is scheduled whenever an input is enqueued.
+// A scheduled Job is run by one worker at a time and processes all queued inputs, so the inputs are processed in order.
+//
+// Each Job has a home worker chosen by the stream id, so the stages of a stream stay on a warm worker.
+// When a worker has nothing to do, it steals a Job from the queue of another worker.
+// An idle worker sleeps on its own queue, and a Job enqueued to a busy worker wakes an idle worker up
+// by enqueueing nullptr (a steal request) to the queue of the idle worker.
+class TranscoderThreadPool
+{
+public:
+	enum class Stage : uint8_t
+	{
+		Decoder,
+		Filter,
+		Encoder
+	};
+
+	class Job : public std::enable_shared_from_this<Job>
+	{
+	public:
+		// Requests to run the task. If the task is running now, it runs once more after it finishes.
+		void Schedule();
+		// Prevents the task from running again, and waits until the running task finishes
+		// (If it is called from the task itself, it doesn't wait)
+		void Cancel();
+
+		bool IsPinned() const
+		{
+			return _pinned;
+		}
+
+	protected:
+		friend class TranscoderThreadPool;
+
+		Job(TranscoderThreadPool *pool, size_t home_worker_index, bool pinned, std::function<void()> task);
+
+		// Returns true if the job needs to be run again
+		bool Run();
+
+		TranscoderThreadPool *_pool;
+		size_t _home_worker_index;
+		// A pinned job is always run by the home worker (for the codecs that must be used in the same thread)
+		bool _pinned;
+		std::function<void()> _task;
+
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		bool _scheduled = false;
+		bool _running = false;
+		bool _cancelled = false;
+		std::thread::id _running_thread_id;
+	};
+
+	static TranscoderThreadPool *GetInstance(Stage stage);
+
+	std::shared_ptr<Job> CreateJob(info::stream_id_t stream_id, bool pinned, std::function<void()> task);
+
+	size_t GetWorkerCount() const
+	{
+		return _queues.size();
+	}
+
+protected:
+	TranscoderThreadPool(Stage stage, size_t worker_count);
+
+	static const char *StringFromStage(Stage stage);
+
+	void Enqueue(const std::shared_ptr<Job> &job, size_t worker_index);
+	// Wakes an idle worker up to steal the job from the queue of worker_index
+	void WakeIdleWorker(size_t worker_index);
+	std::shared_ptr<Job> Steal(size_t worker_index);
+	void WorkerThread(size_t worker_index);
+
+	Stage _stage;
+
+	// The run queue of each worker
+	// The waiting time of a queue is the scheduling latency of the stage, and it is reported to the queue metrics
+	std::vector<std::shared_ptr<ov::ManagedQueue<std::shared_ptr<Job>>>> _queues;
+	std::vector<std::thread> _workers;
+	// true while the worker is sleeping on its queue (or about to sleep)
+	std::unique_ptr<std::atomic<bool>[]> _idle;
+};